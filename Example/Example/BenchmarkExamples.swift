@@ -0,0 +1,396 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+import Engine
+
+#if os(macOS)
+import AppKit
+#else
+import UIKit
+#endif
+
+/// Measures the cost of building and updating a view graph for each
+/// `Engine` primitive against its `AnyView` or `if/else` equivalent.
+///
+/// > Important: Run a Release build on device for meaningful results
+struct BenchmarkExamples: View {
+
+    @State var results: [BenchmarkResult] = []
+    @State var isRunning = false
+
+    var body: some View {
+        Button {
+            isRunning = true
+            DispatchQueue.main.async {
+                results = Benchmarks.run()
+                results.forEach { print($0.description) }
+                isRunning = false
+            }
+        } label: {
+            Text(isRunning ? "Running..." : "Run Benchmarks")
+        }
+        .disabled(isRunning)
+
+        ForEach(results) { result in
+            VStack(alignment: .leading) {
+                Text(result.name)
+                    .font(.headline)
+
+                Text(result.summary)
+                    .font(.caption)
+            }
+        }
+    }
+}
+
+struct BenchmarkResult: Identifiable, CustomStringConvertible {
+    var name: String
+    var makeTime: TimeInterval
+    var updateTime: TimeInterval
+    var iterations: Int
+    var retainedBlocks: Int
+    var retainedBytes: Int
+
+    var id: String { name }
+
+    var updatesPerSecond: Double {
+        Double(iterations) / max(updateTime, .ulpOfOne)
+    }
+
+    var summary: String {
+        String(
+            format: "make %.2fms | update %.3fms (%.0f/s) | retained %+d blocks %+.1fKB",
+            makeTime * 1000,
+            updateTime * 1000 / Double(iterations),
+            updatesPerSecond,
+            retainedBlocks,
+            Double(retainedBytes) / 1024
+        )
+    }
+
+    var description: String {
+        "[Benchmark] \(name): \(summary)"
+    }
+}
+
+/// A view graph to measure, which is built with a seed of `0` and then
+/// updated with a new seed for each iteration.
+///
+/// > Note: The benchmarks are public so that the `ExampleBenchmarks` tests can
+/// import the app without `@testable`, which would require testability in Release.
+public struct Benchmark {
+    public var name: String
+
+    /// Builds the graph and returns the function that updates it
+    public var make: () -> (Int) -> Void
+
+    public init<Content: View>(
+        _ name: String,
+        @ViewBuilder content: @escaping (Int) -> Content
+    ) {
+        self.name = name
+        self.make = {
+            let host = BenchmarkHost(rootView: content(0))
+            return { seed in
+                host.update(rootView: content(seed))
+            }
+        }
+    }
+}
+
+public enum Benchmarks {
+    static let rows = 200
+    public static let iterations = 50
+
+    public static let viewStyle = Benchmark("ViewStyle") { seed in
+        BenchmarkRows(seed: seed) { index in
+            LabeledView {
+                Text(index.description)
+            } label: {
+                Text("Label")
+            }
+            .labeledViewStyle(BorderedLabeledViewStyle())
+        }
+    }
+
+    public static let viewStyleAnyView = Benchmark("ViewStyle (AnyView)") { seed in
+        BenchmarkRows(seed: seed) { index in
+            ErasedLabeledView(
+                label: AnyView(Text("Label")),
+                content: AnyView(Text(index.description)),
+                style: ErasedBorderedLabeledViewStyle()
+            )
+        }
+    }
+
+    public static let viewAlias = Benchmark("ViewAlias") { seed in
+        BenchmarkRows(seed: seed) { index in
+            AliasedRow()
+                .viewAlias(AliasedRow.Content.self) {
+                    Text(index.description)
+                }
+        }
+    }
+
+    public static let viewAliasAnyView = Benchmark("ViewAlias (AnyView)") { seed in
+        BenchmarkRows(seed: seed) { index in
+            ErasedRow(content: AnyView(Text(index.description)))
+        }
+    }
+
+    public static let conditionalContent = Benchmark("ConditionalContent") { seed in
+        BenchmarkRows(seed: seed) { index in
+            ConditionalContent(if: index.isMultiple(of: 2)) {
+                Text(index.description)
+            } else: {
+                Image(systemName: "star")
+            }
+        }
+    }
+
+    public static let conditionalContentIfElse = Benchmark("ConditionalContent (if/else)") { seed in
+        BenchmarkRows(seed: seed) { index in
+            if index.isMultiple(of: 2) {
+                Text(index.description)
+            } else {
+                Image(systemName: "star")
+            }
+        }
+    }
+
+    public static let staticConditionalContent = Benchmark("StaticConditionalContent") { seed in
+        BenchmarkRows(seed: seed) { index in
+            StaticConditionalContent(IsDebug.self) {
+                Text(index.description)
+            } else: {
+                Image(systemName: "star")
+            }
+        }
+    }
+
+    public static let staticConditionalContentIfElse = Benchmark("StaticConditionalContent (if/else)") { seed in
+        BenchmarkRows(seed: seed) { index in
+            if IsDebug.value {
+                Text(index.description)
+            } else {
+                Image(systemName: "star")
+            }
+        }
+    }
+
+    @available(iOS 16.0, macOS 13.0, *)
+    public static var conditionalLayout: Benchmark {
+        Benchmark("ConditionalLayout") { seed in
+            BenchmarkRows(seed: seed) { index in
+                LayoutAdapter {
+                    if index.isMultiple(of: 2) {
+                        HStackLayout()
+                    } else {
+                        VStackLayout()
+                    }
+                } content: {
+                    Text("Layout")
+                    Text(index.description)
+                }
+            }
+        }
+    }
+
+    @available(iOS 16.0, macOS 13.0, *)
+    public static var conditionalLayoutAnyLayout: Benchmark {
+        Benchmark("ConditionalLayout (AnyLayout)") { seed in
+            BenchmarkRows(seed: seed) { index in
+                let layout = index.isMultiple(of: 2) ? AnyLayout(HStackLayout()) : AnyLayout(VStackLayout())
+                layout {
+                    Text("Layout")
+                    Text(index.description)
+                }
+            }
+        }
+    }
+
+    static var all: [Benchmark] {
+        var benchmarks = [
+            viewStyle,
+            viewStyleAnyView,
+            viewAlias,
+            viewAliasAnyView,
+            conditionalContent,
+            conditionalContentIfElse,
+            staticConditionalContent,
+            staticConditionalContentIfElse,
+        ]
+        if #available(iOS 16.0, macOS 13.0, *) {
+            benchmarks.append(conditionalLayout)
+            benchmarks.append(conditionalLayoutAnyLayout)
+        }
+        return benchmarks
+    }
+
+    static func run() -> [BenchmarkResult] {
+        all.map { measure($0) }
+    }
+
+    /// Builds the graph for the `benchmark` once, then updates it with a new
+    /// seed for each iteration.
+    static func measure(
+        _ benchmark: Benchmark
+    ) -> BenchmarkResult {
+        let memory = MallocStatistics()
+
+        var start = CFAbsoluteTimeGetCurrent()
+        let update = benchmark.make()
+        let makeTime = CFAbsoluteTimeGetCurrent() - start
+
+        start = CFAbsoluteTimeGetCurrent()
+        for seed in 1...iterations {
+            update(seed)
+        }
+        let updateTime = CFAbsoluteTimeGetCurrent() - start
+
+        let retained = MallocStatistics().delta(from: memory)
+        return BenchmarkResult(
+            name: benchmark.name,
+            makeTime: makeTime,
+            updateTime: updateTime,
+            iterations: iterations,
+            retainedBlocks: retained.blocks,
+            retainedBytes: retained.bytes
+        )
+    }
+}
+
+/// Hosts the content off screen and forces a layout pass for each update
+private final class BenchmarkHost<Content: View> {
+    static var size: CGSize { CGSize(width: 390, height: 10_000) }
+
+    #if os(macOS)
+    var host: NSHostingView<Content>
+
+    init(rootView: Content) {
+        host = NSHostingView(rootView: rootView)
+        host.frame = CGRect(origin: .zero, size: Self.size)
+        host.layoutSubtreeIfNeeded()
+    }
+
+    func update(rootView: Content) {
+        host.rootView = rootView
+        host.layoutSubtreeIfNeeded()
+    }
+    #else
+    var host: UIHostingController<Content>
+
+    init(rootView: Content) {
+        host = UIHostingController(rootView: rootView)
+        host.view.frame = CGRect(origin: .zero, size: Self.size)
+        _ = host.sizeThatFits(in: Self.size)
+        host.view.layoutIfNeeded()
+    }
+
+    func update(rootView: Content) {
+        host.rootView = rootView
+        _ = host.sizeThatFits(in: Self.size)
+        host.view.layoutIfNeeded()
+    }
+    #endif
+}
+
+/// The heap memory that is in use by the process.
+///
+/// The difference between two statistics is the memory that was retained in
+/// between, such as by the view graph. Memory that is allocated and freed in
+/// between is not counted, so it is not a count of allocations. Use the
+/// Allocations instrument to count those.
+private struct MallocStatistics {
+    var blocks: Int
+    var bytes: Int
+
+    init() {
+        var statistics = malloc_statistics_t()
+        malloc_zone_statistics(nil, &statistics)
+        blocks = Int(statistics.blocks_in_use)
+        bytes = Int(statistics.size_in_use)
+    }
+
+    func delta(from other: MallocStatistics) -> (blocks: Int, bytes: Int) {
+        (blocks - other.blocks, bytes - other.bytes)
+    }
+}
+
+private struct BenchmarkRows<Row: View>: View {
+    var seed: Int
+    var row: (Int) -> Row
+
+    init(seed: Int, @ViewBuilder row: @escaping (Int) -> Row) {
+        self.seed = seed
+        self.row = row
+    }
+
+    var body: some View {
+        VStack {
+            ForEach(0..<Benchmarks.rows, id: \.self) { index in
+                row(index + seed)
+            }
+        }
+    }
+}
+
+// MARK: - Baselines
+
+private struct AliasedRow: View {
+    struct Content: ViewAlias { }
+
+    var body: some View {
+        HStack {
+            Text("Row")
+            Content()
+        }
+    }
+}
+
+private struct ErasedRow: View {
+    var content: AnyView
+
+    var body: some View {
+        HStack {
+            Text("Row")
+            content
+        }
+    }
+}
+
+private protocol ErasedLabeledViewStyle {
+    func makeBody(label: AnyView, content: AnyView) -> AnyView
+}
+
+private struct ErasedBorderedLabeledViewStyle: ErasedLabeledViewStyle {
+    func makeBody(label: AnyView, content: AnyView) -> AnyView {
+        AnyView(
+            HStack(alignment: .firstTextBaseline) {
+                label
+                content
+            }
+            .border(Color.red, width: 2)
+        )
+    }
+}
+
+private struct ErasedLabeledView: View {
+    var label: AnyView
+    var content: AnyView
+    var style: ErasedLabeledViewStyle
+
+    var body: some View {
+        style.makeBody(label: label, content: content)
+    }
+}
+
+struct BenchmarkExamples_Previews: PreviewProvider {
+    static var previews: some View {
+        List {
+            BenchmarkExamples()
+        }
+    }
+}
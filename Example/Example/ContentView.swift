@@ -68,6 +68,22 @@ struct ContentView: View {
             } footer: {
                 Text("Makes conditional view code more performant when the condition can be static.")
             }
+
+            Section {
+                BenchmarkExamples()
+            } header: {
+                Text("Benchmarks")
+            } footer: {
+                Text("Measures the cost of building and updating each primitive against its `AnyView` or `if/else` equivalent. Run a Release build on device for meaningful results.")
+            }
+
+            Section {
+                StressTestExamples()
+            } header: {
+                Text("Stress Tests")
+            } footer: {
+                Text("Exercises each primitive at production scale with a frame time HUD, and a toggle to compare against its `AnyView` or `AnyLayout` equivalent.")
+            }
         }
     }
 }
@@ -0,0 +1,385 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+import QuartzCore
+import Engine
+
+#if os(macOS)
+import AppKit
+#else
+import UIKit
+#endif
+
+/// Screens that exercise each `Engine` primitive at production scale, with a
+/// toggle to swap in the `AnyView` or `AnyLayout` equivalent and a frame time HUD.
+///
+/// > Important: Run a Release build on device for meaningful results
+struct StressTestExamples: View {
+    var body: some View {
+        NavigationLink("Styled Rows", destination: StyledRowsStressTest())
+
+        if #available(iOS 16.0, macOS 13.0, *) {
+            NavigationLink("LayoutThatFits Rows", destination: LayoutThatFitsStressTest())
+        }
+
+        NavigationLink("ForEachSubview", destination: ForEachSubviewStressTest())
+    }
+}
+
+// MARK: - Styled Rows
+
+private struct StyledRowsStressTest: View {
+    @State var isBaseline = false
+    @State var isAnimating = true
+    @StateObject var ticker = Ticker()
+
+    var body: some View {
+        List {
+            ForEach(0..<1_000, id: \.self) { index in
+                if isBaseline {
+                    ErasedStyledRow(index: index, tick: ticker.tick)
+                } else {
+                    StyledRow(index: index, tick: ticker.tick)
+                }
+            }
+        }
+        .labeledViewStyle(BorderedLabeledViewStyle())
+        .labeledViewStyle(PaddedLabeledViewStyle())
+        .labeledViewStyle(BorderedLabeledViewStyle())
+        .stepperViewStyle(InlineStepperViewStyle())
+        .stressTestToolbar(isBaseline: $isBaseline, isAnimating: $isAnimating, baseline: "AnyView")
+        .onChange(of: isAnimating) { ticker.isRunning = $0 }
+        .onAppear { ticker.isRunning = isAnimating }
+        .onDisappear { ticker.isRunning = false }
+    }
+}
+
+private struct StyledRow: View {
+    var index: Int
+    var tick: Int
+    @State var value = 0
+
+    var body: some View {
+        VStack(alignment: .leading) {
+            LabeledView {
+                Text("\(index): \(tick)")
+            } label: {
+                Text("Row")
+            }
+
+            StepperView {
+                Text(value.description)
+            } onIncrement: {
+                value += 1
+            } onDecrement: {
+                value -= 1
+            }
+        }
+    }
+}
+
+private struct ErasedStyledRow: View {
+    var index: Int
+    var tick: Int
+    @State var value = 0
+
+    var body: some View {
+        VStack(alignment: .leading) {
+            AnyView(
+                AnyView(
+                    AnyView(
+                        HStack(alignment: .firstTextBaseline) {
+                            AnyView(Text("Row"))
+                            AnyView(Text("\(index): \(tick)"))
+                        }
+                    )
+                    .border(Color.red, width: 2)
+                )
+                .padding()
+            )
+            .border(Color.red, width: 2)
+
+            AnyView(
+                HStack {
+                    Button {
+                        value -= 1
+                    } label: {
+                        Image(systemName: "minus.circle.fill")
+                    }
+
+                    AnyView(Text(value.description))
+
+                    Button {
+                        value += 1
+                    } label: {
+                        Image(systemName: "plus.circle.fill")
+                    }
+                }
+                .padding(4)
+                .background(
+                    RoundedRectangle(cornerRadius: 8)
+                        .stroke(Color.secondary)
+                )
+            )
+        }
+    }
+}
+
+// MARK: - LayoutThatFits Rows
+
+@available(iOS 16.0, macOS 13.0, *)
+private struct LayoutThatFitsStressTest: View {
+    @State var isBaseline = false
+    @State var isAnimating = true
+    @State var isCompact = false
+
+    var body: some View {
+        List {
+            ForEach(0..<200, id: \.self) { index in
+                Group {
+                    if isBaseline {
+                        let layout = isCompact ? AnyLayout(VStackLayout(alignment: .leading)) : AnyLayout(HStackLayout())
+                        layout {
+                            LayoutThatFitsRowContent(index: index)
+                        }
+                    } else {
+                        LayoutThatFits(in: [.horizontal], tolerance: 8, HStackLayout(), VStackLayout(alignment: .leading)).callAsFunction {
+                            LayoutThatFitsRowContent(index: index)
+                        }
+                    }
+                }
+                .frame(width: isCompact ? 160 : 320, alignment: .leading)
+            }
+        }
+        .animation(.easeInOut(duration: 1), value: isCompact)
+        .stressTestToolbar(isBaseline: $isBaseline, isAnimating: $isAnimating, baseline: "AnyLayout")
+        .onReceive(Timer.publish(every: 1, on: .main, in: .common).autoconnect()) { _ in
+            if isAnimating {
+                isCompact.toggle()
+            }
+        }
+    }
+}
+
+private struct LayoutThatFitsRowContent: View {
+    var index: Int
+
+    var body: some View {
+        Text("Row \(index)")
+            .lineLimit(1)
+        Text("Layout")
+            .lineLimit(1)
+        Text("That Fits")
+            .lineLimit(1)
+    }
+}
+
+// MARK: - ForEachSubview
+
+private struct ForEachSubviewStressTest: View {
+    @State var isBaseline = false
+    @State var isAnimating = true
+    @StateObject var ticker = Ticker()
+
+    var body: some View {
+        ScrollView {
+            LazyVStack(alignment: .leading) {
+                if isBaseline {
+                    ForEach(0..<5_000, id: \.self) { index in
+                        AnyView(
+                            HStack(alignment: .firstTextBaseline) {
+                                Text("\(index + 1).")
+                                Text("Subview \(ticker.tick)")
+                            }
+                        )
+                    }
+                } else {
+                    VariadicViewAdapter { content in
+                        ForEachSubview(content) { index, subview in
+                            HStack(alignment: .firstTextBaseline) {
+                                Text("\(index + 1).")
+                                subview
+                            }
+                        }
+                    } source: {
+                        ForEach(0..<5_000, id: \.self) { _ in
+                            Text("Subview \(ticker.tick)")
+                        }
+                    }
+                }
+            }
+            .padding()
+        }
+        .stressTestToolbar(isBaseline: $isBaseline, isAnimating: $isAnimating, baseline: "AnyView")
+        .onChange(of: isAnimating) { ticker.isRunning = $0 }
+        .onAppear { ticker.isRunning = isAnimating }
+        .onDisappear { ticker.isRunning = false }
+    }
+}
+
+// MARK: - Support
+
+/// Publishes a new tick every frame, to update the content continuously
+private final class Ticker: ObservableObject {
+    @Published var tick = 0
+
+    private var timer: Timer?
+
+    var isRunning = false {
+        didSet {
+            guard isRunning != oldValue else { return }
+            timer?.invalidate()
+            timer = nil
+            if isRunning {
+                timer = Timer.scheduledTimer(withTimeInterval: 1.0 / 60, repeats: true) { [weak self] _ in
+                    self?.tick += 1
+                }
+            }
+        }
+    }
+
+    deinit {
+        timer?.invalidate()
+    }
+}
+
+extension View {
+    fileprivate func stressTestToolbar(
+        isBaseline: Binding<Bool>,
+        isAnimating: Binding<Bool>,
+        baseline: String
+    ) -> some View {
+        overlay(FrameTimeHUD(), alignment: .topTrailing)
+            .toolbar {
+                ToolbarItemGroup {
+                    Toggle(baseline, isOn: isBaseline)
+                    Toggle("Animate", isOn: isAnimating)
+                }
+            }
+    }
+}
+
+/// An overlay of the recent frame times and the number of hitches,
+/// where a hitch is a frame that took longer than 1.5x the expected duration.
+struct FrameTimeHUD: View {
+    @StateObject var monitor = FrameTimeMonitor()
+
+    var body: some View {
+        VStack(alignment: .trailing) {
+            Text(String(format: "%.1f ms avg", monitor.averageFrameTime * 1000))
+            Text(String(format: "%.1f ms max", monitor.maximumFrameTime * 1000))
+            Text(String(format: "%d hitches | %.1f ms/s", monitor.hitches, monitor.hitchTimeRatio * 1000))
+        }
+        .font(.caption)
+        .foregroundColor(monitor.hitches > 0 ? .red : .white)
+        .padding(8)
+        .background(Color.black.opacity(0.75))
+        .cornerRadius(8)
+        .padding()
+        .allowsHitTesting(false)
+        .onAppear { monitor.start() }
+        .onDisappear { monitor.stop() }
+    }
+}
+
+/// Measures the duration of each frame, publishing a summary every second
+final class FrameTimeMonitor: NSObject, ObservableObject {
+    @Published private(set) var averageFrameTime: TimeInterval = 0
+    @Published private(set) var maximumFrameTime: TimeInterval = 0
+    @Published private(set) var hitches: Int = 0
+    @Published private(set) var hitchTimeRatio: Double = 0
+
+    private var lastTimestamp: CFTimeInterval?
+    private var intervalStart: CFTimeInterval = 0
+    private var frameTimes: [TimeInterval] = []
+    private var hitchTime: TimeInterval = 0
+    private var intervalHitches = 0
+
+    #if os(macOS)
+    private var timer: Timer?
+    private var expectedFrameTime: TimeInterval { 1.0 / 60 }
+    #else
+    private var displayLink: CADisplayLink?
+    private var expectedFrameTime: TimeInterval {
+        guard let displayLink = displayLink, displayLink.duration > 0 else {
+            return 1.0 / 60
+        }
+        return displayLink.duration
+    }
+    #endif
+
+    func start() {
+        stop()
+        #if os(macOS)
+        // CADisplayLink is unavailable before macOS 14, so approximate with a timer
+        timer = Timer.scheduledTimer(withTimeInterval: expectedFrameTime, repeats: true) { [weak self] _ in
+            self?.frame(timestamp: CACurrentMediaTime())
+        }
+        #else
+        let displayLink = CADisplayLink(target: self, selector: #selector(onFrame(_:)))
+        displayLink.add(to: .main, forMode: .common)
+        self.displayLink = displayLink
+        #endif
+    }
+
+    func stop() {
+        #if os(macOS)
+        timer?.invalidate()
+        timer = nil
+        #else
+        displayLink?.invalidate()
+        displayLink = nil
+        #endif
+        lastTimestamp = nil
+    }
+
+    #if !os(macOS)
+    @objc
+    private func onFrame(_ displayLink: CADisplayLink) {
+        frame(timestamp: displayLink.timestamp)
+    }
+    #endif
+
+    private func frame(timestamp: CFTimeInterval) {
+        defer { lastTimestamp = timestamp }
+        guard let lastTimestamp = lastTimestamp else {
+            intervalStart = timestamp
+            return
+        }
+
+        let frameTime = timestamp - lastTimestamp
+        frameTimes.append(frameTime)
+        if frameTime > expectedFrameTime * 1.5 {
+            intervalHitches += 1
+            hitchTime += frameTime - expectedFrameTime
+        }
+
+        let interval = timestamp - intervalStart
+        if interval >= 1 {
+            averageFrameTime = frameTimes.reduce(0, +) / Double(frameTimes.count)
+            maximumFrameTime = frameTimes.max() ?? 0
+            hitches = intervalHitches
+            hitchTimeRatio = hitchTime / interval
+            frameTimes.removeAll(keepingCapacity: true)
+            hitchTime = 0
+            intervalHitches = 0
+            intervalStart = timestamp
+        }
+    }
+
+    deinit {
+        stop()
+    }
+}
+
+struct StressTestExamples_Previews: PreviewProvider {
+    static var previews: some View {
+        NavigationView {
+            List {
+                StressTestExamples()
+            }
+        }
+    }
+}
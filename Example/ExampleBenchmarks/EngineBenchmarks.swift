@@ -0,0 +1,152 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import XCTest
+import Example
+
+/// Measures the cost of building and updating a view graph for each `Engine`
+/// primitive against its `AnyView` or `if/else` equivalent, hosted in the
+/// `Example` app.
+///
+/// Each benchmark reports the wall clock time, the CPU instructions retired, and
+/// the peak physical memory of the process. Set a baseline in Xcode for each
+/// test to see regressions from release to release.
+///
+/// > Note: The memory metric is the peak memory in use, not a count of
+/// allocations. Profile a test with the Allocations instrument to count those.
+///
+/// > Important: Run the `ExampleBenchmarks` tests with the Release configuration
+/// on device for meaningful results
+final class EngineBenchmarks: XCTestCase {
+
+    private var metrics: [XCTMetric] {
+        [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]
+    }
+
+    // MARK: - ViewStyle
+
+    func testViewStyleMake() {
+        measureMake(Benchmarks.viewStyle)
+    }
+
+    func testViewStyleUpdate() {
+        measureUpdate(Benchmarks.viewStyle)
+    }
+
+    func testViewStyleAnyViewMake() {
+        measureMake(Benchmarks.viewStyleAnyView)
+    }
+
+    func testViewStyleAnyViewUpdate() {
+        measureUpdate(Benchmarks.viewStyleAnyView)
+    }
+
+    // MARK: - ViewAlias
+
+    func testViewAliasMake() {
+        measureMake(Benchmarks.viewAlias)
+    }
+
+    func testViewAliasUpdate() {
+        measureUpdate(Benchmarks.viewAlias)
+    }
+
+    func testViewAliasAnyViewMake() {
+        measureMake(Benchmarks.viewAliasAnyView)
+    }
+
+    func testViewAliasAnyViewUpdate() {
+        measureUpdate(Benchmarks.viewAliasAnyView)
+    }
+
+    // MARK: - ConditionalContent
+
+    func testConditionalContentMake() {
+        measureMake(Benchmarks.conditionalContent)
+    }
+
+    func testConditionalContentUpdate() {
+        measureUpdate(Benchmarks.conditionalContent)
+    }
+
+    func testConditionalContentIfElseMake() {
+        measureMake(Benchmarks.conditionalContentIfElse)
+    }
+
+    func testConditionalContentIfElseUpdate() {
+        measureUpdate(Benchmarks.conditionalContentIfElse)
+    }
+
+    // MARK: - StaticConditionalContent
+
+    func testStaticConditionalContentMake() {
+        measureMake(Benchmarks.staticConditionalContent)
+    }
+
+    func testStaticConditionalContentUpdate() {
+        measureUpdate(Benchmarks.staticConditionalContent)
+    }
+
+    func testStaticConditionalContentIfElseMake() {
+        measureMake(Benchmarks.staticConditionalContentIfElse)
+    }
+
+    func testStaticConditionalContentIfElseUpdate() {
+        measureUpdate(Benchmarks.staticConditionalContentIfElse)
+    }
+
+    // MARK: - ConditionalLayout
+
+    func testConditionalLayoutMake() throws {
+        guard #available(iOS 16.0, macOS 13.0, *) else {
+            throw XCTSkip("ConditionalLayout requires iOS 16 or macOS 13")
+        }
+        measureMake(Benchmarks.conditionalLayout)
+    }
+
+    func testConditionalLayoutUpdate() throws {
+        guard #available(iOS 16.0, macOS 13.0, *) else {
+            throw XCTSkip("ConditionalLayout requires iOS 16 or macOS 13")
+        }
+        measureUpdate(Benchmarks.conditionalLayout)
+    }
+
+    func testConditionalLayoutAnyLayoutMake() throws {
+        guard #available(iOS 16.0, macOS 13.0, *) else {
+            throw XCTSkip("AnyLayout requires iOS 16 or macOS 13")
+        }
+        measureMake(Benchmarks.conditionalLayoutAnyLayout)
+    }
+
+    func testConditionalLayoutAnyLayoutUpdate() throws {
+        guard #available(iOS 16.0, macOS 13.0, *) else {
+            throw XCTSkip("AnyLayout requires iOS 16 or macOS 13")
+        }
+        measureUpdate(Benchmarks.conditionalLayoutAnyLayout)
+    }
+
+    // MARK: - Support
+
+    /// Measures building the graph of the `benchmark`
+    private func measureMake(_ benchmark: Benchmark) {
+        measure(metrics: metrics) {
+            _ = benchmark.make()
+        }
+    }
+
+    /// Measures ``Benchmarks/iterations`` updates of the graph of the `benchmark`,
+    /// excluding the time to build it
+    private func measureUpdate(_ benchmark: Benchmark) {
+        let options = XCTMeasureOptions()
+        options.invocationOptions = [.manuallyStart, .manuallyStop]
+        measure(metrics: metrics, options: options) {
+            let update = benchmark.make()
+            startMeasuring()
+            for seed in 1...Benchmarks.iterations {
+                update(seed)
+            }
+            stopMeasuring()
+        }
+    }
+}
@@ -1,6 +1,31 @@
 // swift-tools-version: 5.7
 
 import PackageDescription
+import Foundation
+
+/// Set `ENGINE_SIGNPOSTS` when resolving the package to emit `os_signpost` intervals
+var swiftSettings: [SwiftSetting] = ProcessInfo.processInfo.environment["ENGINE_SIGNPOSTS"] != nil
+    ? [.define("ENGINE_SIGNPOSTS")]
+    : []
+
+/// Set `ENGINE_INSTRUMENTATION` when resolving the package to record the
+/// `EngineInstrumentation` counters, including in Release builds
+if ProcessInfo.processInfo.environment["ENGINE_INSTRUMENTATION"] != nil {
+    swiftSettings.append(.define("ENGINE_INSTRUMENTATION"))
+}
+
+/// Set `ENGINE_MINIMUM_VERSION` to `v2`, `v3` or `v4` when resolving the package to
+/// strip the `VersionedView` bodies for versions below the app's deployment target
+///
+/// - `v2`: iOS 14, macOS 11, tvOS 14, watchOS 7
+/// - `v3`: iOS 15, macOS 12, tvOS 15, watchOS 8
+/// - `v4`: iOS 16, macOS 13, tvOS 16, watchOS 9
+if let version = ProcessInfo.processInfo.environment["ENGINE_MINIMUM_VERSION"] {
+    let versions = ["v2", "v3", "v4"]
+    if let index = versions.firstIndex(of: version) {
+        swiftSettings += versions[...index].map { .define("ENGINE_MINIMUM_\($0.uppercased())") }
+    }
+}
 
 let package = Package(
     name: "Engine",
@@ -32,7 +57,8 @@ let package = Package(
             name: "Engine",
             dependencies: [
                 "EngineCore"
-            ]
+            ],
+            swiftSettings: swiftSettings
         )
     ]
 )
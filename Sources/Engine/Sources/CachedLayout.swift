@@ -0,0 +1,243 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A layout that remembers the size of its `InnerLayout` for the most recent proposals.
+///
+/// During an update `sizeThatFits` is often called several times with the same
+/// proposals, such as `.unspecified`, `.zero`, `.infinity` and the concrete size.
+/// A ``CachedLayout`` only asks the `InnerLayout` for the size of a proposal once,
+/// until the subviews change and `updateCache` is called.
+///
+/// The `Cache` of the `InnerLayout` is kept, so the `InnerLayout` should not rely on
+/// `sizeThatFits` being called for a proposal right before `placeSubviews`.
+///
+/// > Important: The sizes are only cleared when SwiftUI calls `updateCache`, which
+/// it does when the subviews change. A layout whose size depends on the environment
+/// of its subviews, such as the size category, should share a ``LayoutMeasurementCache``
+/// that invalidates its sizes with ``View/layoutMeasurementCache(_:)``.
+///
+/// ```
+/// LayoutAdapter {
+///     GridLayout()
+///         .cached()
+/// } content: {
+///     content
+/// }
+/// ```
+///
+/// > Tip: Provide a ``LayoutCacheStatistics`` to count how often a size was reused
+///
+/// The sizes can also be shared between instances with the same content, such as
+/// the rows of a list built from the same template, with ``Layout/cached(in:key:statistics:)``.
+///
+@frozen
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+public struct CachedLayout<InnerLayout: Layout>: Layout {
+
+    @usableFromInline
+    var layout: InnerLayout
+
+    @usableFromInline
+    var statistics: LayoutCacheStatistics?
+
+    @usableFromInline
+    var measurementCache: LayoutMeasurementCache?
+
+    @usableFromInline
+    var measurementKey: AnyHashable?
+
+    /// The layout, if it is `Hashable`, or else the type of the layout
+    @usableFromInline
+    var measurementLayout: AnyHashable?
+
+    @inlinable
+    public init(
+        _ layout: InnerLayout,
+        statistics: LayoutCacheStatistics? = nil
+    ) {
+        self.layout = layout
+        self.statistics = statistics
+    }
+
+    /// - Parameters:
+    ///   - layout: The layout to measure
+    ///   - measurementCache: The cache that is shared with other instances
+    ///   - key: A key that identifies the content, which is equal for instances that have the same size.
+    ///     When `InnerLayout` is not `Hashable`, the key must also identify the parameters of the
+    ///     layout, such as its spacing.
+    ///   - statistics: The statistics to record the hits and misses to
+    @inlinable
+    public init<Key: Hashable>(
+        _ layout: InnerLayout,
+        in measurementCache: LayoutMeasurementCache,
+        key: Key,
+        statistics: LayoutCacheStatistics? = nil
+    ) {
+        self.layout = layout
+        self.statistics = statistics
+        self.measurementCache = measurementCache
+        self.measurementKey = AnyHashable(key)
+        self.measurementLayout = (layout as? AnyHashable) ?? AnyHashable(ObjectIdentifier(InnerLayout.self))
+    }
+
+    public func sizeThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGSize {
+        if let measurementCache = measurementCache, cache.generation != measurementCache.generation {
+            // The shared sizes were invalidated, so the local sizes are too
+            cache.sizes.removeAll()
+            cache.generation = measurementCache.generation
+        }
+        if let size = cache.sizes[proposal] {
+            statistics?.hits += 1
+            return size
+        }
+        var sharedKey: LayoutMeasurementCache.Key?
+        if let measurementKey = measurementKey, let measurementLayout = measurementLayout {
+            sharedKey = LayoutMeasurementCache.Key(
+                content: measurementKey,
+                layout: measurementLayout,
+                count: subviews.count,
+                proposal: proposal
+            )
+        }
+        if let sharedKey = sharedKey, let size = measurementCache?.size(for: sharedKey) {
+            statistics?.hits += 1
+            cache.sizes.store(size, for: proposal)
+            return size
+        }
+        statistics?.misses += 1
+        let size = layout.sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache.cache)
+        cache.sizes.store(size, for: proposal)
+        if let sharedKey = sharedKey {
+            measurementCache?.store(size, for: sharedKey)
+        }
+        return size
+    }
+
+    public func placeSubviews(
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) {
+        layout.placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &cache.cache)
+    }
+
+    public func explicitAlignment(
+        of guide: HorizontalAlignment,
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGFloat? {
+        layout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.cache)
+    }
+
+    public func explicitAlignment(
+        of guide: VerticalAlignment,
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGFloat? {
+        layout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.cache)
+    }
+
+    public func spacing(
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> ViewSpacing {
+        layout.spacing(subviews: subviews, cache: &cache.cache)
+    }
+
+    public struct Cache {
+        var cache: InnerLayout.Cache
+
+        /// The sizes of the most recent proposals
+        var sizes = ProposalCache<CGSize>()
+
+        /// The generation of the ``LayoutMeasurementCache`` the sizes were measured in
+        var generation: Int = 0
+    }
+
+    public func makeCache(
+        subviews: Subviews
+    ) -> Cache {
+        Cache(cache: layout.makeCache(subviews: subviews))
+    }
+
+    public func updateCache(
+        _ cache: inout Cache,
+        subviews: Subviews
+    ) {
+        layout.updateCache(&cache.cache, subviews: subviews)
+        cache.sizes.removeAll()
+    }
+
+    public static var layoutProperties: LayoutProperties {
+        InnerLayout.layoutProperties
+    }
+}
+
+/// The number of times a ``CachedLayout`` reused or measured a size.
+///
+/// A ``LayoutCacheStatistics`` can be shared between several ``CachedLayout``'s,
+/// such as every cell of a grid, to count across all of them.
+///
+public final class LayoutCacheStatistics: CustomStringConvertible {
+
+    /// The number of sizes that were reused
+    public internal(set) var hits: Int = 0
+
+    /// The number of sizes that were measured by the inner layout
+    public internal(set) var misses: Int = 0
+
+    public init() { }
+
+    /// The fraction of sizes that were reused
+    public var hitRate: Double {
+        let total = hits + misses
+        return total > 0 ? Double(hits) / Double(total) : 0
+    }
+
+    public func reset() {
+        hits = 0
+        misses = 0
+    }
+
+    public var description: String {
+        "hits: \(hits), misses: \(misses)"
+    }
+}
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+extension Layout {
+
+    /// Remembers the size of the layout for the most recent proposals
+    @inlinable
+    public func cached(
+        statistics: LayoutCacheStatistics? = nil
+    ) -> CachedLayout<Self> {
+        CachedLayout(self, statistics: statistics)
+    }
+
+    /// Remembers the size of the layout for the most recent proposals, and shares
+    /// the sizes with other layouts in the `measurementCache` with the same `key`.
+    ///
+    /// When the layout is not `Hashable`, such as an `HStackLayout`, the `key` must
+    /// also identify the parameters of the layout, such as its spacing.
+    @inlinable
+    public func cached<Key: Hashable>(
+        in measurementCache: LayoutMeasurementCache,
+        key: Key,
+        statistics: LayoutCacheStatistics? = nil
+    ) -> CachedLayout<Self> {
+        CachedLayout(self, in: measurementCache, key: key, statistics: statistics)
+    }
+}
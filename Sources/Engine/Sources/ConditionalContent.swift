@@ -8,6 +8,10 @@ import SwiftUI
 ///
 /// > Note: Similar to `SwiftUI._ConditionalContent` but with the underlying storage
 /// made public
+///
+/// > Tip: When both branches are `Equatable`, use `equatable()` to skip updating
+/// the branch when it is equal to the previous one. Otherwise, an ``EquatableAdapter``
+/// can compare a part of each branch.
 @frozen
 public struct ConditionalContent<
     TrueContent,
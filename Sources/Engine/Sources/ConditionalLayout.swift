@@ -12,6 +12,11 @@ import EngineCore
 /// since it does not use type-erasure. Additionally, the `Cache` of each `Layout` is
 /// stored separately as opposed to being invalidated when the dynamic condition changes.
 ///
+/// When the condition changes, the `Cache` of the previous layout is kept and is
+/// restored with `updateCache` when the condition changes back. Since nested
+/// ``ConditionalLayout``'s keep their own `Cache` in the same way, every branch
+/// of a ``LayoutBuilder`` `switch` is only made once.
+///
 @frozen
 @available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
 public struct ConditionalLayout<
@@ -23,6 +28,15 @@ public struct ConditionalLayout<
     enum Storage {
         case trueLayout(TrueLayout)
         case falseLayout(FalseLayout)
+
+        var branch: String {
+            switch self {
+            case .trueLayout:
+                return "trueLayout"
+            case .falseLayout:
+                return "falseLayout"
+            }
+        }
     }
 
     @usableFromInline
@@ -43,14 +57,16 @@ public struct ConditionalLayout<
         subviews: Subviews,
         cache: inout Cache
     ) -> CGSize {
+        let signpost = Signpost.begin("sizeThatFits", Self.self)
+        defer { signpost.end(branch: storage.branch) }
         let size: CGSize
         switch (storage, cache.value) {
         case (.trueLayout(let l), .trueCache(var c)):
             size = l.sizeThatFits(proposal: proposal, subviews: subviews, cache: &c)
-            cache = .trueCache(c)
+            cache.value = .trueCache(c)
         case (.falseLayout(let l), .falseCache(var c)):
             size = l.sizeThatFits(proposal: proposal, subviews: subviews, cache: &c)
-            cache = .falseCache(c)
+            cache.value = .falseCache(c)
         default:
             fatalError("Unexpected mismatch between layout and cache")
         }
@@ -63,13 +79,15 @@ public struct ConditionalLayout<
         subviews: Subviews,
         cache: inout Cache
     ) {
+        let signpost = Signpost.begin("placeSubviews", Self.self)
+        defer { signpost.end(branch: storage.branch) }
         switch (storage, cache.value) {
         case (.trueLayout(let l), .trueCache(var c)):
             l.placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &c)
-            cache = .trueCache(c)
+            cache.value = .trueCache(c)
         case (.falseLayout(let l), .falseCache(var c)):
             l.placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &c)
-            cache = .falseCache(c)
+            cache.value = .falseCache(c)
         default:
             fatalError("Unexpected mismatch between layout and cache")
         }
@@ -86,10 +104,10 @@ public struct ConditionalLayout<
         switch (storage, cache.value) {
         case (.trueLayout(let l), .trueCache(var c)):
             alignment = l.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &c)
-            cache = .trueCache(c)
+            cache.value = .trueCache(c)
         case (.falseLayout(let l), .falseCache(var c)):
             alignment = l.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &c)
-            cache = .falseCache(c)
+            cache.value = .falseCache(c)
         default:
             fatalError("Unexpected mismatch between layout and cache")
         }
@@ -107,10 +125,10 @@ public struct ConditionalLayout<
         switch (storage, cache.value) {
         case (.trueLayout(let l), .trueCache(var c)):
             alignment = l.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &c)
-            cache = .trueCache(c)
+            cache.value = .trueCache(c)
         case (.falseLayout(let l), .falseCache(var c)):
             alignment = l.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &c)
-            cache = .falseCache(c)
+            cache.value = .falseCache(c)
         default:
             fatalError("Unexpected mismatch between layout and cache")
         }
@@ -125,10 +143,10 @@ public struct ConditionalLayout<
         switch (storage, cache.value) {
         case (.trueLayout(let l), .trueCache(var c)):
             spacing = l.spacing(subviews: subviews, cache: &c)
-            cache = .trueCache(c)
+            cache.value = .trueCache(c)
         case (.falseLayout(let l), .falseCache(var c)):
             spacing = l.spacing(subviews: subviews, cache: &c)
-            cache = .falseCache(c)
+            cache.value = .falseCache(c)
         default:
             fatalError("Unexpected mismatch between layout and cache")
         }
@@ -159,6 +177,7 @@ public struct ConditionalLayout<
     }
 
     public func makeCache(subviews: Subviews) -> Cache {
+        EngineInstrumentation.shared.record("makeCache", Self.self)
         switch storage {
         case .trueLayout(let layout):
             return .trueCache(layout.makeCache(subviews: subviews))
@@ -174,13 +193,29 @@ public struct ConditionalLayout<
         switch (storage, cache.value) {
         case (.trueLayout(let l), .trueCache(var c)):
             l.updateCache(&c, subviews: subviews)
-            cache = .trueCache(c)
+            cache.value = .trueCache(c)
         case (.falseLayout(let l), .falseCache(var c)):
             l.updateCache(&c, subviews: subviews)
-            cache = .falseCache(c)
-        case (.trueLayout, .falseCache), (.falseLayout, .trueCache):
+            cache.value = .falseCache(c)
+        case (.trueLayout(let l), .falseCache):
+            EngineInstrumentation.shared.record("branchChange", Self.self)
             let oldValue = cache.value
-            cache = makeCache(subviews: subviews)
+            if case .trueCache(var c) = cache.inverseValue {
+                l.updateCache(&c, subviews: subviews)
+                cache.value = .trueCache(c)
+            } else {
+                cache.value = .trueCache(l.makeCache(subviews: subviews))
+            }
+            cache.inverseValue = oldValue
+        case (.falseLayout(let l), .trueCache):
+            EngineInstrumentation.shared.record("branchChange", Self.self)
+            let oldValue = cache.value
+            if case .falseCache(var c) = cache.inverseValue {
+                l.updateCache(&c, subviews: subviews)
+                cache.value = .falseCache(c)
+            } else {
+                cache.value = .falseCache(l.makeCache(subviews: subviews))
+            }
             cache.inverseValue = oldValue
         }
     }
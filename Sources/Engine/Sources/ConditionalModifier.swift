@@ -0,0 +1,88 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A `ViewModifier` that is dynamically either `TrueModifier` or `FalseModifier`.
+///
+/// Each modifier keeps its concrete type and the content it modifies keeps
+/// a separate identity for each branch, as with `if/else` in a `@ViewBuilder`.
+@frozen
+public struct ConditionalModifier<
+    TrueModifier: ViewModifier,
+    FalseModifier: ViewModifier
+>: ViewModifier {
+
+    @frozen
+    public enum Storage {
+        case trueModifier(TrueModifier)
+        case falseModifier(FalseModifier)
+    }
+
+    public var storage: Storage
+
+    @inlinable
+    public init(_ trueModifier: TrueModifier) {
+        self.storage = .trueModifier(trueModifier)
+    }
+
+    @inlinable
+    public init(_ falseModifier: FalseModifier) {
+        self.storage = .falseModifier(falseModifier)
+    }
+
+    @inlinable
+    public init(
+        if condition: Bool,
+        @ViewModifierBuilder then: () -> TrueModifier,
+        @ViewModifierBuilder else: () -> FalseModifier
+    ) {
+        self.storage = condition ? .trueModifier(then()) : .falseModifier(`else`())
+    }
+
+    @ViewBuilder
+    public func body(content: Content) -> some View {
+        switch storage {
+        case .trueModifier(let modifier):
+            content.modifier(modifier)
+        case .falseModifier(let modifier):
+            content.modifier(modifier)
+        }
+    }
+}
+
+extension ConditionalModifier: Equatable where TrueModifier: Equatable, FalseModifier: Equatable {
+    public static func == (lhs: ConditionalModifier<TrueModifier, FalseModifier>, rhs: ConditionalModifier<TrueModifier, FalseModifier>) -> Bool {
+        switch (lhs.storage, rhs.storage) {
+        case (.trueModifier(let lhs), .trueModifier(let rhs)):
+            return lhs == rhs
+        case (.falseModifier(let lhs), .falseModifier(let rhs)):
+            return lhs == rhs
+        default:
+            return false
+        }
+    }
+}
+
+/// A type-erased `ViewModifier`, used for a ``ViewModifierBuilder``
+/// with an `if #available(...)` condition.
+///
+/// > Tip: Use ``VersionedViewModifier`` for availability without type-erasure.
+@frozen
+public struct _AnyViewModifier: ViewModifier {
+
+    @usableFromInline
+    var makeBody: (Content) -> AnyView
+
+    @inlinable
+    public init<Modifier: ViewModifier>(_ modifier: Modifier) {
+        self.makeBody = { content in
+            AnyView(content.modifier(modifier))
+        }
+    }
+
+    public func body(content: Content) -> AnyView {
+        makeBody(content)
+    }
+}
@@ -6,6 +6,23 @@ import SwiftUI
 
 /// A property wrapper that reads a value from a view's environment,
 /// if it was not initialized with a constant value.
+///
+/// When initialized with a constant value, the environment is not read and
+/// so changes to the environment do not invalidate the view.
+///
+/// To depend on only part of a larger environment value, such as a theme,
+/// select the part that is read with ``init(_:select:)``. The view is only
+/// invalidated when the selected value changes.
+///
+/// ```
+/// struct BadgeView: View {
+///     @EnvironmentOrValue(\.theme, select: \.accentColor) var accentColor: Color
+///
+///     var body: some View {
+///         Circle().fill(accentColor)
+///     }
+/// }
+/// ```
 @propertyWrapper
 @frozen
 public struct EnvironmentOrValue<Value>: DynamicProperty {
@@ -29,6 +46,15 @@ public struct EnvironmentOrValue<Value>: DynamicProperty {
         self.storage = .environment(.init(keyPath))
     }
 
+    /// Reads the property at `selector` of the environment value at `keyPath`
+    @inlinable
+    public init<Root>(
+        _ keyPath: KeyPath<EnvironmentValues, Root>,
+        select selector: KeyPath<Root, Value>
+    ) where Value: Equatable {
+        self.storage = .environment(.init(keyPath.appending(path: selector)))
+    }
+
     public var wrappedValue: Value {
         get {
             switch storage {
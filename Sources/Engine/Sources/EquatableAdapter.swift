@@ -0,0 +1,153 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A view that only updates `Content` when `Value` changes.
+///
+/// SwiftUI compares the fields of a view to decide if its `body` should be
+/// evaluated again, which may not be possible for fields such as closures.
+/// An ``EquatableAdapter`` compares only `Value`, so that when a parent is
+/// updated but `Value` is equal to the previous value the `body` of `Content`
+/// and its descendants are not evaluated again.
+///
+/// ```
+/// struct RowView: View {
+///     var item: Item
+///     var onSelect: () -> Void
+///
+///     var body: some View {
+///         ...
+///     }
+/// }
+///
+/// RowView(item: item, onSelect: { select(item) })
+///     .equatable(by: \.item)
+/// ```
+///
+/// > Important: `Value` must capture everything `Content` reads, otherwise
+/// `Content` will not be updated when it changes.
+///
+@frozen
+public struct EquatableAdapter<Content: View, Value: Equatable>: View {
+
+    @usableFromInline
+    var content: Content
+
+    @usableFromInline
+    var value: Value
+
+    /// Updates `content` only when the value at `keyPath` changes
+    @inlinable
+    public init(
+        _ content: Content,
+        by keyPath: KeyPath<Content, Value>
+    ) {
+        self.value = content[keyPath: keyPath]
+        self.content = content
+    }
+
+    /// Updates `content` only when `value` changes
+    @inlinable
+    public init(
+        value: Value,
+        @ViewBuilder content: () -> Content
+    ) {
+        self.value = value
+        self.content = content()
+    }
+
+    private struct Projection: View, Equatable {
+        var content: Content
+        var value: Value
+
+        var body: some View {
+            content
+        }
+
+        static func == (lhs: Projection, rhs: Projection) -> Bool {
+            lhs.value == rhs.value
+        }
+    }
+
+    private var projection: EquatableView<Projection> {
+        EquatableView(content: Projection(content: content, value: value))
+    }
+
+    public var body: Never {
+        bodyError()
+    }
+
+    public static func _makeView(
+        view: _GraphValue<Self>,
+        inputs: _ViewInputs
+    ) -> _ViewOutputs {
+        EquatableView<Projection>._makeView(view: view[\.projection], inputs: inputs)
+    }
+
+    public static func _makeViewList(
+        view: _GraphValue<Self>,
+        inputs: _ViewListInputs
+    ) -> _ViewListOutputs {
+        EquatableView<Projection>._makeViewList(view: view[\.projection], inputs: inputs)
+    }
+
+    @available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *)
+    public static func _viewListCount(
+        inputs: _ViewListCountInputs
+    ) -> Int? {
+        Content._viewListCount(inputs: inputs)
+    }
+}
+
+extension EquatableAdapter where Content: Equatable, Value == Content {
+    /// Updates `content` only when it is not equal to the previous `content`
+    @inlinable
+    public init(_ content: Content) {
+        self.value = content
+        self.content = content
+    }
+}
+
+extension View {
+    /// Updates the view only when the value at `keyPath` changes
+    ///
+    /// > Info: For more on when to skip updates, see ``EquatableAdapter``.
+    @inlinable
+    public func equatable<Value: Equatable>(
+        by keyPath: KeyPath<Self, Value>
+    ) -> EquatableAdapter<Self, Value> {
+        EquatableAdapter(self, by: keyPath)
+    }
+}
+
+extension EquatableAdapter: StaticViewListCount {
+    static var staticViewListCount: Int? {
+        viewListCount(of: Content.self)
+    }
+}
+
+// MARK: - Previews
+
+struct EquatableAdapter_Previews: PreviewProvider {
+    struct Preview: View {
+        @State var counter = 0
+
+        var body: some View {
+            VStack {
+                Button("Increment \(counter)") {
+                    counter += 1
+                }
+
+                EquatableAdapter(value: counter / 5) {
+                    Text("Updated every 5: \(counter)")
+                }
+            }
+        }
+    }
+
+    static var previews: some View {
+        Preview()
+    }
+}
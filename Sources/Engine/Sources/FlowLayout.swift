@@ -0,0 +1,308 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A layout that arranges its subviews in lines, starting a new
+/// line when the next subview does not fit in the available width.
+///
+/// The ideal size of each subview is measured once when the subviews change.
+/// When the available width changes, the lines that still fit are kept and the
+/// line breaks are only computed again from the first line that no longer fits.
+/// A subview that is wider than the available width is proposed the available width,
+/// so that it can truncate or wrap its content.
+///
+/// A subview can be kept on the same line as the subview that follows it with
+/// ``View/flowLayoutKeepWithNext(_:)``, or expanded to fill the remaining width
+/// of its line with ``View/flowLayoutFlexible(_:)``.
+///
+/// ```
+/// LayoutAdapter {
+///     FlowLayout(spacing: 8, lineSpacing: 8)
+/// } content: {
+///     ForEach(filters) { filter in
+///         FilterChip(filter)
+///     }
+/// }
+/// ```
+///
+@frozen
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+public struct FlowLayout: Layout {
+
+    @usableFromInline
+    var spacing: CGFloat
+
+    @usableFromInline
+    var lineSpacing: CGFloat
+
+    @usableFromInline
+    var lineAlignment: VerticalAlignment
+
+    /// - Parameters:
+    ///   - spacing: The horizontal distance between adjacent subviews
+    ///   - lineSpacing: The vertical distance between adjacent lines
+    ///   - lineAlignment: The vertical alignment of the subviews within a line, which
+    ///     is `.top`, `.center` or `.bottom`. Other alignments, such as the text
+    ///     baselines, are treated as `.center`.
+    @inlinable
+    public init(
+        spacing: CGFloat = 8,
+        lineSpacing: CGFloat = 8,
+        lineAlignment: VerticalAlignment = .center
+    ) {
+        self.spacing = spacing
+        self.lineSpacing = lineSpacing
+        self.lineAlignment = lineAlignment
+    }
+
+    /// A hint to keep the subview on the same line as the subview that follows it
+    public enum KeepWithNext: VariadicValueKey {
+        public static var defaultValue: Bool { false }
+    }
+
+    /// A hint to expand the subview to fill the remaining width of its line
+    public enum Flexible: VariadicValueKey {
+        public static var defaultValue: Bool { false }
+    }
+
+    public func sizeThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGSize {
+        let signpost = Signpost.begin("sizeThatFits", Self.self)
+        let width = proposal.width ?? .infinity
+        updateLines(for: width, subviews: subviews, cache: &cache)
+        var size = CGSize.zero
+        for line in cache.lines {
+            size.width = max(size.width, line.width)
+            size.height += line.height
+        }
+        size.height += lineSpacing * CGFloat(max(cache.lines.count - 1, 0))
+        if width.isFinite, cache.flexible.contains(true) {
+            size.width = max(size.width, width)
+        }
+        signpost.end(branch: cache.lines.count.description)
+        return size
+    }
+
+    public func placeSubviews(
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) {
+        let signpost = Signpost.begin("placeSubviews", Self.self)
+        updateLines(for: bounds.width, subviews: subviews, cache: &cache)
+        var y = bounds.minY
+        for line in cache.lines {
+            var extraWidth: CGFloat = 0
+            var flexibleCount = 0
+            for index in line.range where cache.flexible[index] {
+                flexibleCount += 1
+            }
+            if flexibleCount > 0, bounds.width.isFinite {
+                extraWidth = max(bounds.width - line.width, 0) / CGFloat(flexibleCount)
+            }
+
+            var x = bounds.minX
+            for index in line.range {
+                var size = cache.fittedSizes[index]
+                if cache.flexible[index] {
+                    size.width += extraWidth
+                }
+                let anchor: UnitPoint
+                let offset: CGFloat
+                switch lineAlignment {
+                case .top:
+                    anchor = .topLeading
+                    offset = 0
+                case .bottom:
+                    anchor = .bottomLeading
+                    offset = line.height
+                default:
+                    anchor = .leading
+                    offset = line.height / 2
+                }
+                subviews[index].place(
+                    at: CGPoint(x: x, y: y + offset),
+                    anchor: anchor,
+                    proposal: ProposedViewSize(size)
+                )
+                x += size.width + spacing
+            }
+            y += line.height + lineSpacing
+        }
+        signpost.end(branch: cache.lines.count.description)
+    }
+
+    public struct Cache {
+        /// The ideal size of each subview
+        var sizes: [CGSize]
+
+        /// The size of each subview in ``lines``, which is limited to ``width``
+        var fittedSizes: [CGSize]
+
+        var keepWithNext: VariadicValues<KeepWithNext>
+        var flexible: VariadicValues<Flexible>
+
+        /// The lines for ``width``
+        var lines: [Line] = []
+
+        /// The width that the lines were computed for
+        var width: CGFloat?
+
+        struct Line {
+            var range: Range<Int>
+            var width: CGFloat
+            var height: CGFloat
+
+            /// The width needed to fit the next run of subviews on this line
+            var breakWidth: CGFloat
+
+            /// If a subview on this line was measured narrower than its ideal width
+            var isLimited: Bool
+
+            /// Returns `true` if this line breaks at the same subview
+            /// and has the same sizes for `width`
+            func isValid(for width: CGFloat) -> Bool {
+                !isLimited && width >= self.width && width < breakWidth
+            }
+        }
+    }
+
+    public func makeCache(
+        subviews: Subviews
+    ) -> Cache {
+        let sizes = subviews.map { $0.sizeThatFits(.unspecified) }
+        return Cache(
+            sizes: sizes,
+            fittedSizes: sizes,
+            keepWithNext: VariadicValues(subviews: subviews),
+            flexible: VariadicValues(subviews: subviews)
+        )
+    }
+
+    public func updateCache(
+        _ cache: inout Cache,
+        subviews: Subviews
+    ) {
+        cache.sizes.removeAll(keepingCapacity: true)
+        for subview in subviews {
+            cache.sizes.append(subview.sizeThatFits(.unspecified))
+        }
+        cache.fittedSizes = cache.sizes
+        cache.keepWithNext.update(subviews: subviews)
+        cache.flexible.update(subviews: subviews)
+        cache.lines.removeAll(keepingCapacity: true)
+        cache.width = nil
+    }
+
+    /// Computes the line breaks for `width`, keeping the lines that break
+    /// at the same subview as they did for the previous width.
+    private func updateLines(
+        for width: CGFloat,
+        subviews: Subviews,
+        cache: inout Cache
+    ) {
+        guard cache.width != width else { return }
+        if cache.width != nil {
+            let validCount = cache.lines.firstIndex(where: { !$0.isValid(for: width) }) ?? cache.lines.count
+            cache.lines.removeSubrange(validCount...)
+        }
+        cache.width = width
+
+        var index = cache.lines.last?.range.upperBound ?? 0
+        while index < cache.sizes.count {
+            var line = Cache.Line(range: index..<index, width: 0, height: 0, breakWidth: .infinity, isLimited: false)
+            while line.range.upperBound < cache.sizes.count {
+                // Subviews that are kept with the next subview are placed as one run
+                let runStart = line.range.upperBound
+                var runEnd = runStart
+                var runWidth: CGFloat = 0
+                var runHeight: CGFloat = 0
+                var isRunLimited = false
+                repeat {
+                    var size = cache.sizes[runEnd]
+                    if size.width > width {
+                        // Propose the available width, so the subview can truncate or wrap
+                        size = subviews[runEnd].sizeThatFits(ProposedViewSize(width: width, height: nil))
+                        isRunLimited = true
+                    }
+                    cache.fittedSizes[runEnd] = size
+                    runWidth += (runEnd > runStart ? spacing : 0) + size.width
+                    runHeight = max(runHeight, size.height)
+                    runEnd += 1
+                } while runEnd < cache.sizes.count && cache.keepWithNext[runEnd - 1]
+
+                let lineWidth = line.range.isEmpty ? runWidth : line.width + spacing + runWidth
+                if !line.range.isEmpty, lineWidth > width {
+                    line.breakWidth = lineWidth
+                    break
+                }
+                line.range = line.range.lowerBound..<runEnd
+                line.width = lineWidth
+                line.height = max(line.height, runHeight)
+                line.isLimited = line.isLimited || isRunLimited
+            }
+            cache.lines.append(line)
+            index = line.range.upperBound
+        }
+    }
+}
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+extension View {
+
+    /// Keeps the view on the same line of a ``FlowLayout`` as the view that follows it
+    public func flowLayoutKeepWithNext(_ isEnabled: Bool = true) -> some View {
+        variadicValue(FlowLayout.KeepWithNext.self, isEnabled)
+    }
+
+    /// Expands the view to fill the remaining width of its line in a ``FlowLayout``
+    public func flowLayoutFlexible(_ isEnabled: Bool = true) -> some View {
+        variadicValue(FlowLayout.Flexible.self, isEnabled)
+    }
+}
+
+// MARK: - Previews
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+@available(tvOS, unavailable)
+struct FlowLayout_Previews: PreviewProvider {
+    struct Preview: View {
+        @State private var width: CGFloat = 300
+
+        var body: some View {
+            VStack {
+                Slider(value: $width, in: 100...400)
+
+                LayoutAdapter {
+                    FlowLayout()
+                } content: {
+                    ForEach(0..<20, id: \.self) { index in
+                        Text("Item \(index)")
+                            .padding(8)
+                            .background(Color.blue.opacity(0.2))
+                            .flowLayoutKeepWithNext(index == 4)
+                    }
+                    Text("Flexible")
+                        .padding(8)
+                        .background(Color.green.opacity(0.2))
+                        .flowLayoutFlexible()
+                }
+                .frame(width: width)
+                .background(Color.gray.opacity(0.2))
+
+                Spacer()
+            }
+            .padding()
+        }
+    }
+
+    static var previews: some View {
+        Preview()
+    }
+}
@@ -0,0 +1,191 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+#if os(iOS) || os(tvOS)
+
+import SwiftUI
+import UIKit
+
+/// A pool of `UIHostingController`'s that are reused for views of the same type.
+///
+/// When bridging a collection of views to UIKit, such as for a paging or carousel
+/// container, creating a new `UIHostingController` for each view on every update
+/// is costly. A ``HostingControllerPool`` reuses a controller of the same `Content`
+/// type by updating its `rootView` instead.
+///
+/// ```
+/// let pool = HostingControllerPool(limit: 8)
+/// var viewControllers: [UIViewController] = []
+///
+/// func update<Content>(content: MultiViewAdapter<Content>) {
+///     pool.update(&viewControllers, with: content)
+///     pageViewController.setViewControllers(
+///         [viewControllers[currentPage]],
+///         direction: .forward,
+///         animated: false
+///     )
+/// }
+/// ```
+///
+/// At most `limit` controllers are kept in the pool, and the controller that
+/// was returned to the pool the longest time ago is evicted first.
+///
+/// > Important: Remove a controller from its parent before it is returned to the pool.
+///
+@MainActor
+public final class HostingControllerPool {
+
+    /// The maximum number of controllers that are kept for reuse
+    public var limit: Int {
+        get { storage.limit }
+        set {
+            storage.limit = max(newValue, 0)
+            storage.evict()
+        }
+    }
+
+    // The visitors of the pool conform to protocols that are not isolated to the
+    // main actor, so the entries are kept in a storage that the visitors can use
+    // while the pool itself is isolated.
+    private let storage: HostingControllerPoolStorage
+
+    /// - Parameters:
+    ///   - limit: The maximum number of controllers that are kept for reuse
+    public init(limit: Int = 16) {
+        self.storage = HostingControllerPoolStorage(limit: max(limit, 0))
+    }
+
+    /// The number of controllers available for reuse
+    public var count: Int {
+        storage.entries.count
+    }
+
+    /// Returns a controller from the pool of the same `Content` type updated with
+    /// `rootView`, or a new controller if there is none.
+    public func dequeue<Content: View>(
+        rootView: Content
+    ) -> UIHostingController<Content> {
+        storage.dequeue(rootView: rootView)
+    }
+
+    /// Returns a controller from the pool for the concrete `View` type
+    /// of `rootView`, or `nil` if `rootView` is not a `View`.
+    public func dequeue(
+        rootView: Any
+    ) -> UIViewController? {
+        let storage = storage
+        func project<Content>(_ content: Content) -> UIViewController? {
+            guard let conformance = ViewProtocolDescriptor.cachedConformance(of: Content.self) else {
+                return nil
+            }
+            var visitor = DequeueViewVisitor(input: content, storage: storage)
+            conformance.visit(visitor: &visitor)
+            return visitor.output
+        }
+        return _openExistential(rootView, do: project)
+    }
+
+    /// Returns the `viewController` to the pool to be reused
+    public func enqueue(_ viewController: UIViewController) {
+        storage.enqueue(viewController)
+    }
+
+    /// Updates the `viewControllers` to host each element of `content`.
+    ///
+    /// The controller at the same offset is updated in place if it hosts the same
+    /// type of view. Otherwise, a controller is dequeued from the pool, and the
+    /// replaced controllers are returned to the pool.
+    public func update<Content>(
+        _ viewControllers: inout [UIViewController],
+        with content: MultiViewAdapter<Content>
+    ) {
+        var visitor = UpdateVisitor(storage: storage, viewControllers: viewControllers)
+        content.forEach(visitor: &visitor)
+        for viewController in viewControllers where !visitor.output.contains(where: { $0 === viewController }) {
+            storage.enqueue(viewController)
+        }
+        viewControllers = visitor.output
+    }
+
+    /// Removes all of the controllers from the pool
+    public func removeAll() {
+        storage.entries.removeAll()
+    }
+}
+
+/// The entries of a ``HostingControllerPool``, which is only used from the main actor
+private final class HostingControllerPoolStorage {
+
+    struct Entry {
+        var key: ObjectIdentifier
+        var viewController: UIViewController
+    }
+
+    var limit: Int
+
+    /// The controllers available for reuse, in the order they were returned
+    var entries: [Entry] = []
+
+    init(limit: Int) {
+        self.limit = limit
+    }
+
+    func dequeue<Content: View>(
+        rootView: Content
+    ) -> UIHostingController<Content> {
+        let key = ObjectIdentifier(UIHostingController<Content>.self)
+        if let index = entries.lastIndex(where: { $0.key == key }) {
+            let viewController = unsafeDowncast(
+                entries.remove(at: index).viewController,
+                to: UIHostingController<Content>.self
+            )
+            viewController.rootView = rootView
+            return viewController
+        }
+        return UIHostingController(rootView: rootView)
+    }
+
+    func enqueue(_ viewController: UIViewController) {
+        guard !entries.contains(where: { $0.viewController === viewController }) else {
+            return
+        }
+        entries.append(Entry(key: ObjectIdentifier(type(of: viewController)), viewController: viewController))
+        evict()
+    }
+
+    func evict() {
+        if entries.count > limit {
+            entries.removeFirst(entries.count - limit)
+        }
+    }
+}
+
+private struct DequeueViewVisitor<Input>: ViewVisitor {
+    var input: Input
+    var storage: HostingControllerPoolStorage
+    var output: UIViewController!
+
+    mutating func visit<Content>(type: Content.Type) where Content: View {
+        output = storage.dequeue(rootView: unsafeBitCast(input, to: Content.self))
+    }
+}
+
+private struct UpdateVisitor: MultiViewElementVisitor {
+    var storage: HostingControllerPoolStorage
+    var viewControllers: [UIViewController]
+    var output: [UIViewController] = []
+
+    mutating func visit<Element: View>(element: Element, offset: Int) {
+        if offset < viewControllers.count,
+            let viewController = viewControllers[offset] as? UIHostingController<Element>
+        {
+            viewController.rootView = element
+            output.append(viewController)
+        } else {
+            output.append(storage.dequeue(rootView: element))
+        }
+    }
+}
+
+#endif
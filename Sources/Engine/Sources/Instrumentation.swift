@@ -0,0 +1,250 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+import os.lock
+
+/// Counters of the work done by `Engine`'s primitives and tagged subtrees,
+/// to find views that are evaluated or laid out more often than expected.
+///
+/// When enabled, each `Engine` primitive counts its graph, layout and cache
+/// events by its type, such as the `sizeThatFits` and `placeSubviews` calls of a
+/// ``LayoutThatFits``, or a ``ConditionalLayout`` changing its branch. Subtrees
+/// that are tagged with ``View/instrumented(_:)`` count the body evaluations of
+/// the view that creates them.
+///
+/// ```
+/// EngineInstrumentation.shared.isEnabled = true
+///
+/// var body: some View {
+///     FeedView()
+///         .instrumented("Feed")
+///         .overlay(EngineInstrumentationHUD(), alignment: .topTrailing)
+/// }
+/// ```
+///
+/// The counters accumulate until they are reset, and each consumer, such as the
+/// ``EngineInstrumentationHUD`` and ``startLogging(every:)``, takes the difference
+/// from its own previous ``snapshot()`` with ``counters(_:since:)``.
+///
+/// > Note: The counters are only recorded when `Engine` is compiled with the
+/// `ENGINE_INSTRUMENTATION` condition, which can be used in Release builds. Set the
+/// `ENGINE_INSTRUMENTATION` environment variable when resolving the package to enable it.
+///
+public final class EngineInstrumentation {
+
+    public static let shared = EngineInstrumentation()
+
+    /// The counts of each event for a primitive type or a tagged subtree
+    public struct Counter: Identifiable {
+        public var name: String
+        public var counts: [String: Int]
+
+        var key: Key
+
+        public var id: AnyHashable { key }
+
+        /// The total count of all events
+        public var total: Int {
+            counts.values.reduce(0, +)
+        }
+    }
+
+    /// The identity of a counter, since a type and a tag can have the same name
+    enum Key: Hashable {
+        case type(ObjectIdentifier)
+        case tag(String)
+    }
+
+    /// If the counters should be recorded, which is `false` by default
+    public var isEnabled: Bool {
+        get {
+            os_unfair_lock_lock(lock)
+            defer { os_unfair_lock_unlock(lock) }
+            return enabled
+        }
+        set {
+            os_unfair_lock_lock(lock)
+            enabled = newValue
+            os_unfair_lock_unlock(lock)
+        }
+    }
+
+    private let lock: UnsafeMutablePointer<os_unfair_lock>
+    private var enabled = false
+    private var names: [Key: String] = [:]
+    private var counts: [Key: [String: Int]] = [:]
+    private var timer: Timer?
+
+    private init() {
+        lock = .allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock())
+    }
+
+    /// Records an `event` of a primitive of `type`
+    func record(_ event: StaticString, _ type: Any.Type) {
+        #if ENGINE_INSTRUMENTATION
+        record(event.description, key: .type(ObjectIdentifier(type)), name: String(describing: type))
+        #endif
+    }
+
+    /// Records an `event` of the subtree tagged with `tag`
+    func record(_ event: StaticString, tag: String) {
+        #if ENGINE_INSTRUMENTATION
+        record(event.description, key: .tag(tag), name: tag)
+        #endif
+    }
+
+    private func record(_ event: String, key: Key, name: @autoclosure () -> String) {
+        os_unfair_lock_lock(lock)
+        defer { os_unfair_lock_unlock(lock) }
+        guard enabled else { return }
+        if names[key] == nil {
+            names[key] = name()
+        }
+        counts[key, default: [:]][event, default: 0] += 1
+    }
+
+    /// The counters since they were last reset, with the most events first
+    public func snapshot() -> [Counter] {
+        os_unfair_lock_lock(lock)
+        defer { os_unfair_lock_unlock(lock) }
+        return counts
+            .map { Counter(name: names[$0.key] ?? "", counts: $0.value, key: $0.key) }
+            .sorted { $0.total > $1.total }
+    }
+
+    /// The events since the `previous` snapshot, with the most events first
+    ///
+    /// ```
+    /// var previous = EngineInstrumentation.shared.snapshot()
+    /// // ...
+    /// let current = EngineInstrumentation.shared.snapshot()
+    /// let counters = EngineInstrumentation.counters(current, since: previous)
+    /// previous = current
+    /// ```
+    public static func counters(
+        _ current: [Counter],
+        since previous: [Counter]
+    ) -> [Counter] {
+        var previousCounts: [Key: [String: Int]] = [:]
+        for counter in previous {
+            previousCounts[counter.key] = counter.counts
+        }
+        return current
+            .compactMap { counter -> Counter? in
+                let previous = previousCounts[counter.key] ?? [:]
+                var counts: [String: Int] = [:]
+                for (event, count) in counter.counts {
+                    // A reset makes the count lower than the previous count
+                    let previousCount = previous[event] ?? 0
+                    let delta = count >= previousCount ? count - previousCount : count
+                    if delta > 0 {
+                        counts[event] = delta
+                    }
+                }
+                return counts.isEmpty ? nil : Counter(name: counter.name, counts: counts, key: counter.key)
+            }
+            .sorted { $0.total > $1.total }
+    }
+
+    /// Resets the counters of every consumer
+    public func reset() {
+        os_unfair_lock_lock(lock)
+        counts.removeAll(keepingCapacity: true)
+        os_unfair_lock_unlock(lock)
+    }
+
+    /// Enables recording and prints the counters every `interval` as the rate per second
+    public func startLogging(every interval: TimeInterval = 1) {
+        stopLogging()
+        isEnabled = true
+        var previous = snapshot()
+        timer = Timer.scheduledTimer(withTimeInterval: interval, repeats: true) { [weak self] _ in
+            guard let self = self else { return }
+            let current = self.snapshot()
+            let counters = EngineInstrumentation.counters(current, since: previous)
+            previous = current
+            for counter in counters.prefix(10) {
+                let rates = counter.counts
+                    .sorted { $0.key < $1.key }
+                    .map { "\($0.key): \(String(format: "%.1f", Double($0.value) / interval))/s" }
+                    .joined(separator: ", ")
+                print("[Engine] \(counter.name) \(rates)")
+            }
+        }
+    }
+
+    public func stopLogging() {
+        timer?.invalidate()
+        timer = nil
+    }
+}
+
+extension View {
+    /// Counts the body evaluations that create this view as `tag`, in ``EngineInstrumentation``
+    ///
+    /// > Note: The body evaluations are only counted when `Engine` is compiled
+    /// with the `ENGINE_INSTRUMENTATION` condition
+    public func instrumented(_ tag: String) -> Self {
+        #if ENGINE_INSTRUMENTATION
+        EngineInstrumentation.shared.record("body", tag: tag)
+        #endif
+        return self
+    }
+}
+
+/// An overlay of the ``EngineInstrumentation`` counters with the
+/// most events, as the rate per second.
+public struct EngineInstrumentationHUD: View {
+
+    var limit: Int
+
+    /// Shared by every HUD, rather than made on each evaluation of `body`
+    private static let timer = Timer.publish(every: 1, on: .main, in: .common).autoconnect()
+
+    @State private var counters: [EngineInstrumentation.Counter] = []
+    @State private var previous: [EngineInstrumentation.Counter] = []
+
+    /// - Parameters:
+    ///   - limit: The maximum number of counters to show
+    public init(limit: Int = 8) {
+        self.limit = limit
+    }
+
+    public var body: some View {
+        VStack(alignment: .leading, spacing: 2) {
+            #if ENGINE_INSTRUMENTATION
+            ForEach(counters.prefix(limit)) { counter in
+                Text(counter.name)
+                    .lineLimit(1)
+                Text(
+                    counter.counts
+                        .sorted { $0.key < $1.key }
+                        .map { "\($0.key) \($0.value)/s" }
+                        .joined(separator: " ")
+                )
+                .foregroundColor(.secondary)
+            }
+            #else
+            Text("Instrumentation requires the ENGINE_INSTRUMENTATION condition")
+            #endif
+        }
+        .font(.caption)
+        .padding(8)
+        .background(Color.black.opacity(0.75))
+        .foregroundColor(.white)
+        .cornerRadius(8)
+        .padding()
+        .allowsHitTesting(false)
+        .onAppear {
+            previous = EngineInstrumentation.shared.snapshot()
+        }
+        .onReceive(Self.timer) { _ in
+            let current = EngineInstrumentation.shared.snapshot()
+            counters = EngineInstrumentation.counters(current, since: previous)
+            previous = current
+        }
+    }
+}
@@ -19,6 +19,27 @@ import SwiftUI
 ///     }
 /// }
 /// ```
+///
+/// A `switch` or an `if/else if` chain with more than two branches is built as nested
+/// ``ConditionalLayout``'s. The `Cache` of every branch is retained when the
+/// branch changes, so returning to a previous layout updates its existing `Cache`
+/// rather than making a new one.
+///
+/// ```
+/// var sizeClass: UserInterfaceSizeClass?
+/// var dynamicTypeSize: DynamicTypeSize
+///
+/// @LayoutBuilder
+/// var layout: some Layout {
+///     if dynamicTypeSize.isAccessibilitySize {
+///         VStackLayout()
+///     } else if sizeClass == .compact {
+///         GridLayout()
+///     } else {
+///         HStackLayout()
+///     }
+/// }
+/// ```
 @resultBuilder
 @available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
 public struct LayoutBuilder {
@@ -49,4 +70,10 @@ public struct LayoutBuilder {
     ) -> ConditionalLayout<TrueLayout, FalseLayout> {
         ConditionalLayout(second)
     }
+
+    public static func buildLimitedAvailability<L: Layout>(
+        _ layout: L
+    ) -> AnyLayout {
+        AnyLayout(layout)
+    }
 }
@@ -0,0 +1,231 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A cache of layout sizes that is shared between layouts with the same content.
+///
+/// In a list where many rows are built from the same template, each row measures
+/// its subviews independently even though the result is the same. Rows that join a
+/// ``LayoutMeasurementCache`` with ``Layout/cached(in:key:statistics:)`` and an
+/// equal `key` only measure their content once for each proposal.
+///
+/// ```
+/// let measurementCache = LayoutMeasurementCache(limit: 256)
+///
+/// var body: some View {
+///     List(items) { item in
+///         LayoutAdapter {
+///             LayoutThatFits(in: [.horizontal], HStackLayout(), VStackLayout())
+///                 .cached(in: measurementCache, key: [item.title, item.subtitle])
+///         } content: {
+///             Text(item.title)
+///             Text(item.subtitle)
+///         }
+///     }
+///     .layoutMeasurementCache(measurementCache)
+/// }
+/// ```
+///
+/// The `key` must identify everything that affects the size of the content, such as
+/// both the title and the subtitle in the example above. Two rows with the same title
+/// but different subtitles would otherwise reuse each other's sizes. Layouts
+/// that are `Hashable` are part of the key, but for other layouts, such as an
+/// `HStackLayout`, the `key` must also identify the parameters of the layout. Sizes
+/// that depend on the environment are invalidated by ``View/layoutMeasurementCache(_:)``
+/// when the size category, locale or layout direction changes.
+///
+/// At most `limit` sizes are kept, and the least recently used size is evicted first.
+///
+/// > Important: A ``LayoutMeasurementCache`` should only be used from the main thread.
+///
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+public final class LayoutMeasurementCache {
+
+    @usableFromInline
+    struct Key: Hashable {
+        var content: AnyHashable
+        var layout: AnyHashable
+        var count: Int
+        var width: CGFloat?
+        var height: CGFloat?
+
+        @usableFromInline
+        init(
+            content: AnyHashable,
+            layout: AnyHashable,
+            count: Int,
+            proposal: ProposedViewSize
+        ) {
+            self.content = content
+            self.layout = layout
+            self.count = count
+            self.width = proposal.width
+            self.height = proposal.height
+        }
+    }
+
+    private struct Node {
+        var key: Key
+        var size: CGSize
+        var previous: Int?
+        var next: Int?
+    }
+
+    /// The maximum number of sizes that are kept
+    public let limit: Int
+
+    private var indices: [Key: Int] = [:]
+    private var nodes: [Node] = []
+
+    /// The most recently used node
+    private var head: Int?
+
+    /// The least recently used node
+    private var tail: Int?
+
+    /// The environment the sizes were measured in
+    private var environment: MeasurementEnvironment?
+
+    /// Incremented each time the sizes are removed, so that layouts can
+    /// discard the sizes they copied from the cache
+    private(set) var generation: Int = 0
+
+    struct MeasurementEnvironment: Equatable {
+        var sizeCategory: ContentSizeCategory
+        var locale: Locale
+        var layoutDirection: LayoutDirection
+    }
+
+    /// - Parameters:
+    ///   - limit: The maximum number of sizes that are kept
+    public init(limit: Int = 512) {
+        self.limit = max(limit, 1)
+    }
+
+    /// The number of sizes that are kept
+    public var count: Int {
+        nodes.count
+    }
+
+    /// Removes all of the sizes
+    public func removeAll() {
+        generation += 1
+        indices.removeAll(keepingCapacity: true)
+        nodes.removeAll(keepingCapacity: true)
+        head = nil
+        tail = nil
+    }
+
+    @usableFromInline
+    func size(for key: Key) -> CGSize? {
+        guard let index = indices[key] else {
+            return nil
+        }
+        moveToHead(index)
+        return nodes[index].size
+    }
+
+    @usableFromInline
+    func store(_ size: CGSize, for key: Key) {
+        if let index = indices[key] {
+            nodes[index].size = size
+            moveToHead(index)
+            return
+        }
+
+        let index: Int
+        if nodes.count < limit {
+            index = nodes.count
+            nodes.append(Node(key: key, size: size))
+        } else {
+            // Reuse the least recently used node
+            index = tail!
+            unlink(index)
+            indices[nodes[index].key] = nil
+            nodes[index] = Node(key: key, size: size)
+        }
+        indices[key] = index
+        link(index)
+    }
+
+    func update(environment newValue: MeasurementEnvironment) {
+        if environment != newValue {
+            if environment != nil {
+                removeAll()
+            }
+            environment = newValue
+        }
+    }
+
+    private func moveToHead(_ index: Int) {
+        guard head != index else { return }
+        unlink(index)
+        link(index)
+    }
+
+    /// Inserts the node at `index` as the most recently used
+    private func link(_ index: Int) {
+        nodes[index].previous = nil
+        nodes[index].next = head
+        if let head = head {
+            nodes[head].previous = index
+        }
+        head = index
+        if tail == nil {
+            tail = index
+        }
+    }
+
+    private func unlink(_ index: Int) {
+        let node = nodes[index]
+        if let previous = node.previous {
+            nodes[previous].next = node.next
+        } else {
+            head = node.next
+        }
+        if let next = node.next {
+            nodes[next].previous = node.previous
+        } else {
+            tail = node.previous
+        }
+        nodes[index].previous = nil
+        nodes[index].next = nil
+    }
+}
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+extension View {
+
+    /// Invalidates the sizes in `measurementCache` when the environment that
+    /// affects measurement changes, such as the size category.
+    ///
+    /// > Info: For more on sharing sizes between layouts, see ``LayoutMeasurementCache``.
+    public func layoutMeasurementCache(
+        _ measurementCache: LayoutMeasurementCache
+    ) -> some View {
+        modifier(LayoutMeasurementCacheModifier(measurementCache: measurementCache))
+    }
+}
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+private struct LayoutMeasurementCacheModifier: ViewModifier {
+    var measurementCache: LayoutMeasurementCache
+
+    @Environment(\.sizeCategory) var sizeCategory
+    @Environment(\.locale) var locale
+    @Environment(\.layoutDirection) var layoutDirection
+
+    func body(content: Content) -> some View {
+        // Invalidate before the content is laid out in the new environment
+        measurementCache.update(
+            environment: .init(
+                sizeCategory: sizeCategory,
+                locale: locale,
+                layoutDirection: layoutDirection
+            )
+        )
+        return content
+    }
+}
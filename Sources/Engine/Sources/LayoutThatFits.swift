@@ -6,6 +6,14 @@ import SwiftUI
 
 /// A layout that adapts to the available space by providing the first
 /// child layout that fits.
+///
+/// > Tip: Use ``StaticLayoutThatFits`` to avoid the type-erasure of `AnyLayout`.
+///
+/// When the available space changes gradually, such as during an animation, a
+/// `tolerance` can be provided to avoid switching back and forth between layouts
+/// near the point where a layout no longer fits. Once a layout has been placed, a
+/// preceding layout is only chosen again when it fits with `tolerance` to spare.
+///
 @frozen
 @available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
 public struct LayoutThatFits: Layout {
@@ -16,19 +24,36 @@ public struct LayoutThatFits: Layout {
     @usableFromInline
     var layouts: [AnyLayout]
 
+    @usableFromInline
+    var tolerance: CGFloat
+
+    @usableFromInline
+    var search: Search
+
+    /// The strategy used to find the layout that fits
+    @frozen
+    public enum Search {
+        /// Each layout is measured in order until one fits
+        case linear
+
+        /// The layouts are ordered from largest to smallest, such that if a layout
+        /// does not fit then neither does any preceding layout.
+        ///
+        /// The search starts from the layout that was last placed and then narrows
+        /// in with a binary search, so that a small change in the available space
+        /// typically only measures one or two layouts.
+        case ordered
+    }
+
     public func sizeThatFits(
         proposal: ProposedViewSize,
         subviews: Subviews,
         cache: inout Cache
     ) -> CGSize {
-        var sizeThatFits: CGSize = .zero
-        visit(cache: &cache) { stop, cache, layout in
-            if stop || layoutFits(layout: layout, proposal: proposal, subviews: subviews, cache: &cache) {
-                stop = true
-                sizeThatFits = layout.sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache)
-            }
-        }
-        return sizeThatFits
+        let signpost = Signpost.begin("sizeThatFits", Self.self)
+        let fit = layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache)
+        signpost.end(branch: fit.index.description)
+        return fit.size
     }
 
     public func placeSubviews(
@@ -37,12 +62,18 @@ public struct LayoutThatFits: Layout {
         subviews: Subviews,
         cache: inout Cache
     ) {
-        visit(cache: &cache) { stop, cache, layout in
-            if stop || layoutFits(layout: layout, proposal: proposal, subviews: subviews, cache: &cache) {
-                stop = true
-                layout.placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &cache)
+        let signpost = Signpost.begin("placeSubviews", Self.self)
+        let index = layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache).index
+        layouts[index].placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &cache.caches[index])
+        if cache.placedIndex != index {
+            EngineInstrumentation.shared.record("layoutChange", Self.self)
+            cache.placedIndex = index
+            if tolerance > 0 {
+                // The fits were chosen relative to the previously placed layout
+                cache.fits.removeAll()
             }
         }
+        signpost.end(branch: index.description)
     }
 
     public func explicitAlignment(
@@ -52,14 +83,8 @@ public struct LayoutThatFits: Layout {
         subviews: Subviews,
         cache: inout Cache
     ) -> CGFloat? {
-        var alignment: CGFloat?
-        visit(cache: &cache) { stop, cache, layout in
-            if stop || layoutFits(layout: layout, proposal: proposal, subviews: subviews, cache: &cache) {
-                stop = true
-                alignment = layout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache)
-            }
-        }
-        return alignment
+        let index = layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache).index
+        return layouts[index].explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.caches[index])
     }
 
     public func explicitAlignment(
@@ -69,23 +94,35 @@ public struct LayoutThatFits: Layout {
         subviews: Subviews,
         cache: inout Cache
     ) -> CGFloat? {
-        var alignment: CGFloat?
-        visit(cache: &cache) { stop, cache, layout in
-            if stop || layoutFits(layout: layout, proposal: proposal, subviews: subviews, cache: &cache) {
-                stop = true
-                alignment = layout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache)
-            }
-        }
-        return alignment
+        let index = layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache).index
+        return layouts[index].explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.caches[index])
     }
 
     public struct Cache {
         var caches: [AnyLayout.Cache]
+
+        /// The layout that was chosen for the most recent proposals, so that
+        /// repeated calls within a layout pass do not measure each layout again.
+        var fits = ProposalCache<Fit>()
+
+        /// The layout that was last placed, which a preceding layout must fit
+        /// within the tolerance to replace.
+        var placedIndex: Int?
+
+        /// The layout that was last chosen for any proposal, where an ordered
+        /// search starts from until a layout has been placed.
+        var chosenIndex: Int?
+
+        struct Fit {
+            var index: Int
+            var size: CGSize
+        }
     }
 
     public func makeCache(
         subviews: Subviews
     ) -> Cache {
+        EngineInstrumentation.shared.record("makeCache", Self.self)
         let caches = layouts.map { $0.makeCache(subviews: subviews) }
         return Cache(caches: caches)
     }
@@ -97,31 +134,131 @@ public struct LayoutThatFits: Layout {
         for index in layouts.indices {
             layouts[index].updateCache(&cache.caches[index], subviews: subviews)
         }
+        cache.fits.removeAll()
     }
 
-    private func visit(
-        cache: inout Cache,
-        _ accessor: (inout Bool, inout AnyLayout.Cache, AnyLayout) -> Void
-    ) {
-        var stop = false
+    private func layoutThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> Cache.Fit {
+        if let fit = cache.fits[proposal] {
+            return fit
+        }
+
+        let fit: Cache.Fit
+        switch search {
+        case .linear:
+            fit = linearLayoutThatFits(proposal: proposal, subviews: subviews, cache: &cache)
+        case .ordered:
+            fit = orderedLayoutThatFits(proposal: proposal, subviews: subviews, cache: &cache)
+        }
+        cache.chosenIndex = fit.index
+        cache.fits.store(fit, for: proposal)
+        return fit
+    }
+
+    private func linearLayoutThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> Cache.Fit {
         var index = 0
-        while !stop {
-            stop = index == layouts.count - 1
-            accessor(&stop, &cache.caches[index], layouts[index])
+        var size: CGSize = .zero
+        while index < layouts.count {
+            let result = layoutFits(at: index, proposal: proposal, subviews: subviews, cache: &cache)
+            size = result.size
+            if result.fits {
+                break
+            }
             index += 1
         }
+        return Cache.Fit(index: index, size: size)
+    }
+
+    private func orderedLayoutThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> Cache.Fit {
+        // The largest index known to not fit and the smallest index known to fit
+        var lowerBound = -1
+        var upperBound = layouts.count - 1
+        var upperBoundSize: CGSize?
+
+        // Gallop away from the last placed layout to bound the search. The
+        // chosen layout is also updated by probes, such as `.unspecified`
+        // and `.zero`, so it is only used before a layout has been placed.
+        let start = min(cache.placedIndex ?? cache.chosenIndex ?? 0, layouts.count - 1)
+        let (startFits, startSize) = layoutFits(at: start, proposal: proposal, subviews: subviews, cache: &cache)
+        var step = 1
+        if startFits {
+            upperBound = start
+            upperBoundSize = startSize
+            while upperBound - lowerBound > 1 {
+                let index = max(upperBound - step, lowerBound + 1)
+                let (fits, size) = layoutFits(at: index, proposal: proposal, subviews: subviews, cache: &cache)
+                if fits {
+                    upperBound = index
+                    upperBoundSize = size
+                    step *= 2
+                } else {
+                    lowerBound = index
+                    break
+                }
+            }
+        } else {
+            lowerBound = start
+            while upperBound - lowerBound > 1 {
+                let index = min(lowerBound + step, upperBound - 1)
+                let (fits, size) = layoutFits(at: index, proposal: proposal, subviews: subviews, cache: &cache)
+                if fits {
+                    upperBound = index
+                    upperBoundSize = size
+                    break
+                } else {
+                    lowerBound = index
+                    step *= 2
+                }
+            }
+        }
+
+        // Binary search within the bounds
+        while upperBound - lowerBound > 1 {
+            let index = lowerBound + (upperBound - lowerBound) / 2
+            let (fits, size) = layoutFits(at: index, proposal: proposal, subviews: subviews, cache: &cache)
+            if fits {
+                upperBound = index
+                upperBoundSize = size
+            } else {
+                lowerBound = index
+            }
+        }
+
+        let size = upperBoundSize ?? layouts[upperBound].sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache.caches[upperBound])
+        return Cache.Fit(index: upperBound, size: size)
     }
 
+    /// Measures the layout at `index`, which always fits if it is the last layout
     private func layoutFits(
-        layout: AnyLayout,
+        at index: Int,
         proposal: ProposedViewSize,
         subviews: Subviews,
-        cache: inout AnyLayout.Cache
-    ) -> Bool {
-        let size = layout.sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache)
+        cache: inout Cache
+    ) -> (fits: Bool, size: CGSize) {
+        let size = layouts[index].sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache.caches[index])
+        let margin = index < (cache.placedIndex ?? 0) ? tolerance : 0
+        let fits = index == layouts.count - 1 || sizeFits(size, proposal: proposal, margin: margin)
+        return (fits, size)
+    }
 
-        let widthFits = size.width <= (proposal.width ?? .infinity)
-        let heightFits = size.height <= (proposal.height ?? .infinity)
+    private func sizeFits(
+        _ size: CGSize,
+        proposal: ProposedViewSize,
+        margin: CGFloat
+    ) -> Bool {
+        let widthFits = size.width + margin <= (proposal.width ?? .infinity)
+        let heightFits = size.height + margin <= (proposal.height ?? .infinity)
 
         let layoutFits = (widthFits || !axes.contains(.horizontal)) && (heightFits || !axes.contains(.vertical))
         return layoutFits
@@ -136,10 +273,11 @@ extension LayoutThatFits {
         L2: Layout
     >(
         in axes: Axis.Set = [.horizontal, .vertical],
+        tolerance: CGFloat = 0,
         _ l1: L1,
         _ l2: L2
     ) {
-        self.init(in: axes, [AnyLayout(l1), AnyLayout(l2)])
+        self.init(in: axes, tolerance: tolerance, [AnyLayout(l1), AnyLayout(l2)])
     }
 
     @inlinable
@@ -149,11 +287,12 @@ extension LayoutThatFits {
         L3: Layout
     >(
         in axes: Axis.Set = [.horizontal, .vertical],
+        tolerance: CGFloat = 0,
         _ l1: L1,
         _ l2: L2,
         _ l3: L3
     ) {
-        self.init(in: axes, [AnyLayout(l1), AnyLayout(l2), AnyLayout(l3)])
+        self.init(in: axes, tolerance: tolerance, [AnyLayout(l1), AnyLayout(l2), AnyLayout(l3)])
     }
 
     @inlinable
@@ -164,12 +303,13 @@ extension LayoutThatFits {
         L4: Layout
     >(
         in axes: Axis.Set = [.horizontal, .vertical],
+        tolerance: CGFloat = 0,
         _ l1: L1,
         _ l2: L2,
         _ l3: L3,
         _ l4: L4
     ) {
-        self.init(in: axes, [AnyLayout(l1), AnyLayout(l2), AnyLayout(l3), AnyLayout(l4)])
+        self.init(in: axes, tolerance: tolerance, [AnyLayout(l1), AnyLayout(l2), AnyLayout(l3), AnyLayout(l4)])
     }
 
     @inlinable
@@ -181,21 +321,31 @@ extension LayoutThatFits {
         L5: Layout
     >(
         in axes: Axis.Set = [.horizontal, .vertical],
+        tolerance: CGFloat = 0,
         _ l1: L1,
         _ l2: L2,
         _ l3: L3,
         _ l4: L4,
         _ l5: L5
     ) {
-        self.init(in: axes, [AnyLayout(l1), AnyLayout(l2), AnyLayout(l3), AnyLayout(l4), AnyLayout(l5)])
+        self.init(in: axes, tolerance: tolerance, [AnyLayout(l1), AnyLayout(l2), AnyLayout(l3), AnyLayout(l4), AnyLayout(l5)])
     }
 
-    @usableFromInline
-    init(
+    /// - Parameters:
+    ///   - axes: The axes the layouts must fit within
+    ///   - tolerance: The space a preceding layout must have to spare to replace the placed layout
+    ///   - search: The strategy used to find the layout that fits
+    ///   - layouts: The layouts, in order of preference
+    public init(
         in axes: Axis.Set = [.horizontal, .vertical],
+        tolerance: CGFloat = 0,
+        search: Search = .linear,
         _ layouts: [AnyLayout]
     ) {
+        precondition(!layouts.isEmpty, "LayoutThatFits requires at least one layout")
         self.axes = axes
+        self.tolerance = max(tolerance, 0)
+        self.search = search
         self.layouts = layouts
     }
 }
@@ -222,7 +372,7 @@ struct LayoutThatFits_Previews: PreviewProvider {
             VStack {
                 Slider(value: $width, in: 0...400)
 
-                LayoutThatFits(in: [.horizontal], _HStackLayout(spacing: nil), _VStackLayout(spacing: nil)).callAsFunction {
+                LayoutThatFits(in: [.horizontal], tolerance: 20, _HStackLayout(spacing: nil), _VStackLayout(spacing: nil)).callAsFunction {
                     content
                 }
                 .frame(width: width)
@@ -0,0 +1,127 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A container view with type-erased subviews, of which only the
+/// subviews within a window of indices are built.
+///
+/// The total ``count`` is read from the variadic view, which does not require every
+/// subview to be created.
+@frozen
+public struct LazyVariadicView<Content: View>: View {
+
+    /// The range of subviews that are built, including any overscan
+    public var indices: Range<Int>
+
+    @usableFromInline
+    var children: AnyVariadicView
+
+    init(_ children: _VariadicView.Children, indices: Range<Int>) {
+        self.children = AnyVariadicView(children)
+        self.indices = indices
+    }
+
+    /// The total number of subviews
+    public var count: Int {
+        children.count
+    }
+
+    /// The subview at the position, which should be within ``indices``
+    public subscript(position: Int) -> AnyVariadicView.Subview {
+        children[position]
+    }
+
+    public var body: some View {
+        children[indices]
+    }
+}
+
+/// A view that transforms a view into a variadic view, of which only
+/// the subviews within `window` are built.
+///
+/// Use a ``LazyVariadicViewAdapter`` if the `Source` can produce a large number
+/// of subviews, such as a `ForEach`, and only a portion are visible at a time.
+///
+/// ```
+/// LazyVariadicViewAdapter(window: 0..<20, overscan: 5) { content in
+///     VStack {
+///         content
+///     }
+/// } source: {
+///     ForEach(0..<10_000, id: \.self) { index in
+///         Text(index.description)
+///     }
+/// }
+/// ```
+@frozen
+public struct LazyVariadicViewAdapter<Source: View, Content: View>: View {
+
+    @usableFromInline
+    var window: Range<Int>
+
+    @usableFromInline
+    var overscan: Int
+
+    @usableFromInline
+    var source: Source
+
+    @usableFromInline
+    var content: (LazyVariadicView<Source>) -> Content
+
+    /// - Parameters:
+    ///   - window: The indices of the subviews that are visible
+    ///   - overscan: The number of additional subviews to build before and after the `window`
+    @inlinable
+    public init(
+        window: Range<Int>,
+        overscan: Int = 0,
+        @ViewBuilder content: @escaping (LazyVariadicView<Source>) -> Content,
+        @ViewBuilder source: () -> Source
+    ) {
+        self.window = window
+        self.overscan = max(overscan, 0)
+        self.source = source()
+        self.content = content
+    }
+
+    public var body: some View {
+        _VariadicView.Tree(Root(window: window, overscan: overscan, content: content)) {
+            source
+        }
+    }
+
+    private struct Root: _VariadicView.UnaryViewRoot {
+        var window: Range<Int>
+        var overscan: Int
+        var content: (LazyVariadicView<Source>) -> Content
+
+        func body(children: _VariadicView.Children) -> some View {
+            let count = children.count
+            let upperBound = min(max(window.upperBound + overscan, 0), count)
+            let lowerBound = min(max(window.lowerBound - overscan, 0), upperBound)
+            return content(LazyVariadicView(children, indices: lowerBound..<upperBound))
+        }
+    }
+}
+
+// MARK: - Previews
+
+struct LazyVariadicView_Previews: PreviewProvider {
+    static var previews: some View {
+        LazyVariadicViewAdapter(window: 10..<15, overscan: 2) { content in
+            VStack {
+                Text("\(content.indices.count) of \(content.count)")
+
+                content
+            }
+        } source: {
+            ForEach(0..<10_000, id: \.self) { index in
+                Text("Line \(index)")
+            }
+        }
+        .padding()
+        .previewLayout(.sizeThatFits)
+    }
+}
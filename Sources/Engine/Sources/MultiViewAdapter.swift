@@ -23,6 +23,10 @@ import EngineCore
 /// collection of views to a `UIViewController` when bridging to UIKit
 /// components.
 ///
+/// > Tip: Use ``MultiViewAdapter/visit(at:visitor:)`` or
+/// ``MultiViewAdapter/forEach(visitor:)`` with a ``MultiViewElementVisitor``
+/// to access the elements without being type-erased to `AnyView`.
+///
 @frozen
 public struct MultiViewAdapter<Content>: View, RandomAccessCollection {
 
@@ -55,23 +59,15 @@ public struct MultiViewAdapter<Content>: View, RandomAccessCollection {
     }
 
     public var endIndex: Index {
-        swift_getTupleCount(content.value) ?? 1
+        // Read from the type of `Content`, so constructing an adapter
+        // does not walk the tuple
+        tupleCount(of: Content.self) ?? 1
     }
 
     public subscript(position: Index) -> Element {
-        var element = swift_getTupleElement(position, content.value)
-        if element == nil, position == 0 {
-            element = content.value
-        }
-        precondition(element != nil, "Index out of range")
-
-        func project<T>(_ value: T) -> Element {
-            let conformance = ViewProtocolDescriptor.conformance(of: T.self)!
-            var visitor = AnyViewVisitor(input: value)
-            conformance.visit(visitor: &visitor)
-            return visitor.output
-        }
-        return _openExistential(element!, do: project)
+        var visitor = AnyViewVisitor()
+        visit(at: position, visitor: &visitor)
+        return visitor.output
     }
 
     public func index(after index: Index) -> Index {
@@ -88,21 +84,27 @@ public struct MultiViewAdapter<Content>: View, RandomAccessCollection {
         view: _GraphValue<Self>,
         inputs: _ViewInputs
     ) -> _ViewOutputs {
-        TupleView<Content>._makeView(view: view[\.content], inputs: inputs)
+        let signpost = Signpost.begin("_makeView", Self.self)
+        defer { signpost.end() }
+        return TupleView<Content>._makeView(view: view[\.content], inputs: inputs)
     }
 
     public static func _makeViewList(
         view: _GraphValue<Self>,
         inputs: _ViewListInputs
     ) -> _ViewListOutputs {
-        TupleView<Content>._makeViewList(view: view[\.content], inputs: inputs)
+        let signpost = Signpost.begin("_makeViewList", Self.self)
+        defer { signpost.end() }
+        return TupleView<Content>._makeViewList(view: view[\.content], inputs: inputs)
     }
 
     @available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *)
     public static func _viewListCount(
         inputs: _ViewListCountInputs
     ) -> Int? {
-        TupleView<Content>._viewListCount(inputs: inputs)
+        let signpost = Signpost.begin("_viewListCount", Self.self)
+        defer { signpost.end() }
+        return TupleView<Content>._viewListCount(inputs: inputs)
     }
 }
 
@@ -112,11 +114,69 @@ extension MultiViewAdapter: MultiView {
     public var views: Content { content.value }
 }
 
-private struct AnyViewVisitor<Input>: ViewVisitor {
+/// A visitor for the elements of a ``MultiViewAdapter`` that is
+/// provided each element with its concrete `View` type.
+///
+///     struct HostingControllerVisitor: MultiViewElementVisitor {
+///         var viewControllers: [UIViewController] = []
+///
+///         mutating func visit<Element: View>(element: Element, offset: Int) {
+///             viewControllers.append(UIHostingController(rootView: element))
+///         }
+///     }
+///
+public protocol MultiViewElementVisitor {
+    mutating func visit<Element: View>(element: Element, offset: Int)
+}
+
+extension MultiViewAdapter {
+
+    /// Visits the element at `position` with its concrete `View` type,
+    /// which avoids the type-erasure of `AnyView`.
+    public func visit<Visitor: MultiViewElementVisitor>(
+        at position: Index,
+        visitor: inout Visitor
+    ) {
+        var element = swift_getTupleElement(position, content.value)
+        if element == nil, position == 0 {
+            element = content.value
+        }
+        precondition(element != nil, "Index out of range")
+
+        func project<T>(_ value: T) {
+            let conformance = ViewProtocolDescriptor.cachedConformance(of: T.self)!
+            var elementVisitor = ElementViewVisitor(input: value, offset: position, visitor: visitor)
+            conformance.visit(visitor: &elementVisitor)
+            visitor = elementVisitor.visitor
+        }
+        _openExistential(element!, do: project)
+    }
+
+    /// Visits each element in order with its concrete `View` type,
+    /// which avoids the type-erasure of `AnyView`.
+    public func forEach<Visitor: MultiViewElementVisitor>(
+        visitor: inout Visitor
+    ) {
+        for position in indices {
+            visit(at: position, visitor: &visitor)
+        }
+    }
+}
+
+private struct ElementViewVisitor<Input, Visitor: MultiViewElementVisitor>: ViewVisitor {
     var input: Input
-    var output: AnyView!
+    var offset: Int
+    var visitor: Visitor
 
     mutating func visit<Content>(type: Content.Type) where Content: View {
-        output = AnyView(unsafeBitCast(input, to: Content.self))
+        visitor.visit(element: unsafeBitCast(input, to: Content.self), offset: offset)
+    }
+}
+
+private struct AnyViewVisitor: MultiViewElementVisitor {
+    var output: AnyView!
+
+    mutating func visit<Element: View>(element: Element, offset: Int) {
+        output = AnyView(element)
     }
 }
@@ -0,0 +1,57 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// The values that a layout computed for its most recent proposals.
+///
+/// During an update `sizeThatFits` is often called several times with the same
+/// proposals, such as `.unspecified`, `.zero`, `.infinity` and the concrete size.
+/// A ``ProposalCache`` remembers the value for each of the most recent proposals,
+/// so that repeated calls within a layout pass do not compute it again.
+///
+/// The values are stored inline rather than in an `Array`, so a cache does not
+/// allocate. This matters for layouts that nest a cache at each level, such as
+/// the fallbacks of a ``StaticLayoutThatFits``.
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+struct ProposalCache<Value> {
+
+    /// The maximum number of proposals to remember
+    static var limit: Int { 4 }
+
+    private typealias Entry = (proposal: ProposedViewSize, value: Value)
+
+    private var entries: (Entry?, Entry?, Entry?, Entry?) = (nil, nil, nil, nil)
+
+    /// The index of the entry that is replaced next, which is the oldest entry
+    private var next = 0
+
+    init() { }
+
+    /// The value for `proposal`, if it is one of the most recent proposals
+    subscript(proposal: ProposedViewSize) -> Value? {
+        if let entry = entries.0, entry.proposal == proposal { return entry.value }
+        if let entry = entries.1, entry.proposal == proposal { return entry.value }
+        if let entry = entries.2, entry.proposal == proposal { return entry.value }
+        if let entry = entries.3, entry.proposal == proposal { return entry.value }
+        return nil
+    }
+
+    /// Stores the `value` for `proposal`, replacing the oldest proposal when full
+    mutating func store(_ value: Value, for proposal: ProposedViewSize) {
+        let entry: Entry = (proposal, value)
+        switch next {
+        case 0: entries.0 = entry
+        case 1: entries.1 = entry
+        case 2: entries.2 = entry
+        default: entries.3 = entry
+        }
+        next = (next + 1) % Self.limit
+    }
+
+    mutating func removeAll() {
+        entries = (nil, nil, nil, nil)
+        next = 0
+    }
+}
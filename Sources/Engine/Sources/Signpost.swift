@@ -0,0 +1,53 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import Foundation
+
+#if ENGINE_SIGNPOSTS
+import os.signpost
+#endif
+
+/// An interval that is visible in the Points of Interest instrument
+/// when `Engine` is compiled with the `ENGINE_SIGNPOSTS` condition.
+///
+/// Set the `ENGINE_SIGNPOSTS` environment variable when resolving the
+/// package to enable tracing. Otherwise, a ``Signpost`` is empty and
+/// compiles to nothing.
+///
+struct Signpost {
+
+    #if ENGINE_SIGNPOSTS
+    private static let log = OSLog(subsystem: "com.nathantannar.Engine", category: .pointsOfInterest)
+
+    private let name: StaticString
+    private let id: OSSignpostID
+
+    private init(name: StaticString, type: Any.Type) {
+        self.name = name
+        self.id = OSSignpostID(log: Signpost.log)
+        os_signpost(.begin, log: Signpost.log, name: name, signpostID: id, "%{public}s", String(describing: type))
+    }
+    #endif
+
+    /// Begins an interval for `type`, which is also counted by ``EngineInstrumentation``
+    @inline(__always)
+    static func begin(_ name: StaticString, _ type: Any.Type) -> Signpost {
+        #if ENGINE_INSTRUMENTATION
+        EngineInstrumentation.shared.record(name, type)
+        #endif
+        #if ENGINE_SIGNPOSTS
+        return Signpost(name: name, type: type)
+        #else
+        return Signpost()
+        #endif
+    }
+
+    /// Ends the interval, recording the `branch` that was chosen
+    @inline(__always)
+    func end(branch: @autoclosure () -> String = String()) {
+        #if ENGINE_SIGNPOSTS
+        os_signpost(.end, log: Signpost.log, name: name, signpostID: id, "%{public}s", branch())
+        #endif
+    }
+}
@@ -6,6 +6,23 @@ import SwiftUI
 
 /// A property wrapper that can read and write a value from
 /// a wrapped `State` or `Binding`
+///
+/// When `Value` is `Equatable`, setting a value that is equal to the current
+/// value is skipped so that views which depend on the value are not invalidated.
+///
+/// A ``StateOrBinding`` for a property of the value can be derived with
+/// ``init(_:_:)``, which projects the binding by key path rather than wrapping
+/// it in new closures.
+///
+/// ```
+/// struct FormView: View {
+///     @StateOrBinding var settings: Settings
+///
+///     var body: some View {
+///         VolumeSlider(volume: StateOrBinding(_settings, \.volume))
+///     }
+/// }
+/// ```
 @propertyWrapper
 @frozen
 public struct StateOrBinding<Value>: DynamicProperty {
@@ -29,6 +46,15 @@ public struct StateOrBinding<Value>: DynamicProperty {
         self.storage = .binding(binding)
     }
 
+    /// Reads and writes the property at `keyPath` of the value of `parent`
+    @inlinable
+    public init<Root>(
+        _ parent: StateOrBinding<Root>,
+        _ keyPath: WritableKeyPath<Root, Value>
+    ) {
+        self.storage = .binding(parent.projectedValue[dynamicMember: keyPath])
+    }
+
     public var wrappedValue: Value {
         get {
             switch storage {
@@ -41,13 +67,21 @@ public struct StateOrBinding<Value>: DynamicProperty {
         nonmutating set {
             switch storage {
             case .state(let state):
+                guard !isEqual(state.wrappedValue, newValue) else { return }
                 state.wrappedValue = newValue
             case .binding(let binding):
+                guard !isEqual(binding.wrappedValue, newValue) else { return }
                 binding.wrappedValue = newValue
             }
         }
     }
 
+    #if ENGINE_INSTRUMENTATION
+    public func update() {
+        EngineInstrumentation.shared.record("update", Self.self)
+    }
+    #endif
+
     public var projectedValue: Binding<Value> {
         switch storage {
         case .state(let state):
@@ -58,6 +92,27 @@ public struct StateOrBinding<Value>: DynamicProperty {
     }
 }
 
+/// Returns `true` when `Value` is `Equatable` and the values are equal.
+///
+/// The conformance is checked on the type of `Value`, not on the values, so
+/// neither value is boxed in an existential and nothing is stored in the property
+/// wrapper. The conformance is answered by the runtime's per-type conformance cache.
+func isEqual<Value>(_ lhs: Value, _ rhs: Value) -> Bool {
+    guard let type = Value.self as? any Equatable.Type else {
+        return false
+    }
+    return isEqual(type, lhs, rhs)
+}
+
+private func isEqual<T: Equatable, Value>(
+    _ : T.Type,
+    _ lhs: Value,
+    _ rhs: Value
+) -> Bool {
+    // `T` is `Value`, so the values can be reinterpreted without a cast
+    unsafeBitCast(lhs, to: T.self) == unsafeBitCast(rhs, to: T.self)
+}
+
 // MARK: - Previews
 
 struct StateOrBinding_Previews: PreviewProvider {
@@ -3,11 +3,84 @@
 //
 
 import SwiftUI
+import os.lock
 
 /// A statically defined condition
 ///
 /// > Important: The evaluation result should be static
 ///
+/// > Tip: Use ``Cached`` when evaluating the condition is costly, such as reading
+/// a feature flag, and ``And``, ``Or`` and ``Not`` to compose conditions.
+///
 public protocol StaticCondition {
     static var value: Bool { get }
 }
+
+/// A ``StaticCondition`` that evaluates `Condition` once per process.
+///
+///     struct IsFeatureEnabled: StaticCondition {
+///         static var value: Bool {
+///             ProcessInfo.processInfo.arguments.contains("-FeatureEnabled")
+///         }
+///     }
+///
+///     StaticConditionalContent(Cached<IsFeatureEnabled>.self) {
+///         FeatureView()
+///     }
+///
+public struct Cached<Condition: StaticCondition>: StaticCondition {
+    public static var value: Bool {
+        StaticConditionCache.shared.value(for: Condition.self)
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when both `LHS` and `RHS` are `true`.
+public struct And<LHS: StaticCondition, RHS: StaticCondition>: StaticCondition {
+    public static var value: Bool {
+        LHS.value && RHS.value
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when either `LHS` or `RHS` is `true`.
+public struct Or<LHS: StaticCondition, RHS: StaticCondition>: StaticCondition {
+    public static var value: Bool {
+        LHS.value || RHS.value
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when `Condition` is `false`.
+public struct Not<Condition: StaticCondition>: StaticCondition {
+    public static var value: Bool {
+        !Condition.value
+    }
+}
+
+private final class StaticConditionCache {
+
+    static let shared = StaticConditionCache()
+
+    private let lock: UnsafeMutablePointer<os_unfair_lock>
+    private var values: [ObjectIdentifier: Bool] = [:]
+
+    private init() {
+        lock = .allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock())
+    }
+
+    func value<Condition: StaticCondition>(for condition: Condition.Type) -> Bool {
+        let key = ObjectIdentifier(condition)
+        os_unfair_lock_lock(lock)
+        if let value = values[key] {
+            os_unfair_lock_unlock(lock)
+            return value
+        }
+        os_unfair_lock_unlock(lock)
+
+        // Evaluate outside of the lock, since the condition may itself be `Cached`
+        let value = Condition.value
+        os_unfair_lock_lock(lock)
+        values[key] = value
+        os_unfair_lock_unlock(lock)
+        return value
+    }
+}
@@ -50,7 +50,9 @@ public struct StaticConditionalContent<
         view: _GraphValue<Self>,
         inputs: _ViewInputs
     ) -> _ViewOutputs {
-        Condition.value
+        let signpost = Signpost.begin("_makeView", Self.self)
+        defer { signpost.end(branch: Condition.value ? "then" : "else") }
+        return Condition.value
             ? TrueContent._makeView(view: view[\.trueContent], inputs: inputs)
             : FalseContent._makeView(view: view[\.falseContent], inputs: inputs)
     }
@@ -59,7 +61,9 @@ public struct StaticConditionalContent<
         view: _GraphValue<Self>,
         inputs: _ViewListInputs
     ) -> _ViewListOutputs {
-        Condition.value
+        let signpost = Signpost.begin("_makeViewList", Self.self)
+        defer { signpost.end(branch: Condition.value ? "then" : "else") }
+        return Condition.value
             ? TrueContent._makeViewList(view: view[\.trueContent], inputs: inputs)
             : FalseContent._makeViewList(view: view[\.falseContent], inputs: inputs)
     }
@@ -68,7 +72,9 @@ public struct StaticConditionalContent<
     public static func _viewListCount(
         inputs: _ViewListCountInputs
     ) -> Int? {
-        Condition.value
+        let signpost = Signpost.begin("_viewListCount", Self.self)
+        defer { signpost.end(branch: Condition.value ? "then" : "else") }
+        return Condition.value
             ? TrueContent._viewListCount(inputs: inputs)
             : FalseContent._viewListCount(inputs: inputs)
     }
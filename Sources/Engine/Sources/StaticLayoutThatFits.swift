@@ -0,0 +1,248 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A layout that adapts to the available space by providing the first
+/// child layout that fits.
+///
+/// A ``StaticLayoutThatFits`` can be more performant than ``LayoutThatFits``
+/// since it does not use type-erasure. Each candidate keeps its concrete type and its
+/// own `Cache`. More than two candidates are represented by nesting another
+/// ``StaticLayoutThatFits`` as the `FallbackLayout`.
+///
+@frozen
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+public struct StaticLayoutThatFits<
+    PrimaryLayout: Layout,
+    FallbackLayout: Layout
+>: Layout {
+
+    @usableFromInline
+    var axes: Axis.Set
+
+    @usableFromInline
+    var primaryLayout: PrimaryLayout
+
+    @usableFromInline
+    var fallbackLayout: FallbackLayout
+
+    @inlinable
+    public init(
+        in axes: Axis.Set = [.horizontal, .vertical],
+        _ primaryLayout: PrimaryLayout,
+        _ fallbackLayout: FallbackLayout
+    ) {
+        self.axes = axes
+        self.primaryLayout = primaryLayout
+        self.fallbackLayout = fallbackLayout
+    }
+
+    public func sizeThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGSize {
+        let signpost = Signpost.begin("sizeThatFits", Self.self)
+        let fit = layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache)
+        signpost.end(branch: fit.isPrimary ? "primary" : "fallback")
+        return fit.size
+    }
+
+    public func placeSubviews(
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) {
+        let signpost = Signpost.begin("placeSubviews", Self.self)
+        let isPrimary = layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache).isPrimary
+        if isPrimary {
+            primaryLayout.placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &cache.primaryCache)
+        } else {
+            fallbackLayout.placeSubviews(in: bounds, proposal: proposal, subviews: subviews, cache: &cache.fallbackCache)
+        }
+        signpost.end(branch: isPrimary ? "primary" : "fallback")
+    }
+
+    public func explicitAlignment(
+        of guide: HorizontalAlignment,
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGFloat? {
+        if layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache).isPrimary {
+            return primaryLayout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.primaryCache)
+        } else {
+            return fallbackLayout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.fallbackCache)
+        }
+    }
+
+    public func explicitAlignment(
+        of guide: VerticalAlignment,
+        in bounds: CGRect,
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> CGFloat? {
+        if layoutThatFits(proposal: proposal, subviews: subviews, cache: &cache).isPrimary {
+            return primaryLayout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.primaryCache)
+        } else {
+            return fallbackLayout.explicitAlignment(of: guide, in: bounds, proposal: proposal, subviews: subviews, cache: &cache.fallbackCache)
+        }
+    }
+
+    public struct Cache {
+        var primaryCache: PrimaryLayout.Cache
+        var fallbackCache: FallbackLayout.Cache
+
+        /// The layout that was chosen for the most recent proposals, so that
+        /// repeated calls within a layout pass do not measure each layout again.
+        var fits = ProposalCache<Fit>()
+
+        struct Fit {
+            var isPrimary: Bool
+            var size: CGSize
+        }
+    }
+
+    public func makeCache(
+        subviews: Subviews
+    ) -> Cache {
+        Cache(
+            primaryCache: primaryLayout.makeCache(subviews: subviews),
+            fallbackCache: fallbackLayout.makeCache(subviews: subviews)
+        )
+    }
+
+    public func updateCache(
+        _ cache: inout Cache,
+        subviews: Subviews
+    ) {
+        primaryLayout.updateCache(&cache.primaryCache, subviews: subviews)
+        fallbackLayout.updateCache(&cache.fallbackCache, subviews: subviews)
+        cache.fits.removeAll()
+    }
+
+    public static var layoutProperties: LayoutProperties {
+        PrimaryLayout.layoutProperties.combined(with: FallbackLayout.layoutProperties)
+    }
+
+    private func layoutThatFits(
+        proposal: ProposedViewSize,
+        subviews: Subviews,
+        cache: inout Cache
+    ) -> Cache.Fit {
+        if let fit = cache.fits[proposal] {
+            return fit
+        }
+
+        let fit: Cache.Fit
+        let size = primaryLayout.sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache.primaryCache)
+        if sizeFits(size, proposal: proposal) {
+            fit = Cache.Fit(isPrimary: true, size: size)
+        } else {
+            // A nested `StaticLayoutThatFits` continues the search with its own candidates
+            let size = fallbackLayout.sizeThatFits(proposal: proposal, subviews: subviews, cache: &cache.fallbackCache)
+            fit = Cache.Fit(isPrimary: false, size: size)
+        }
+        cache.fits.store(fit, for: proposal)
+        return fit
+    }
+
+    private func sizeFits(
+        _ size: CGSize,
+        proposal: ProposedViewSize
+    ) -> Bool {
+        let widthFits = size.width <= (proposal.width ?? .infinity)
+        let heightFits = size.height <= (proposal.height ?? .infinity)
+
+        let layoutFits = (widthFits || !axes.contains(.horizontal)) && (heightFits || !axes.contains(.vertical))
+        return layoutFits
+    }
+}
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+extension StaticLayoutThatFits {
+    @inlinable
+    public init<
+        L2: Layout,
+        L3: Layout
+    >(
+        in axes: Axis.Set = [.horizontal, .vertical],
+        _ l1: PrimaryLayout,
+        _ l2: L2,
+        _ l3: L3
+    ) where FallbackLayout == StaticLayoutThatFits<L2, L3> {
+        self.init(in: axes, l1, StaticLayoutThatFits<L2, L3>(in: axes, l2, l3))
+    }
+
+    @inlinable
+    public init<
+        L2: Layout,
+        L3: Layout,
+        L4: Layout
+    >(
+        in axes: Axis.Set = [.horizontal, .vertical],
+        _ l1: PrimaryLayout,
+        _ l2: L2,
+        _ l3: L3,
+        _ l4: L4
+    ) where FallbackLayout == StaticLayoutThatFits<L2, StaticLayoutThatFits<L3, L4>> {
+        self.init(in: axes, l1, StaticLayoutThatFits<L2, StaticLayoutThatFits<L3, L4>>(in: axes, l2, l3, l4))
+    }
+
+    @inlinable
+    public init<
+        L2: Layout,
+        L3: Layout,
+        L4: Layout,
+        L5: Layout
+    >(
+        in axes: Axis.Set = [.horizontal, .vertical],
+        _ l1: PrimaryLayout,
+        _ l2: L2,
+        _ l3: L3,
+        _ l4: L4,
+        _ l5: L5
+    ) where FallbackLayout == StaticLayoutThatFits<L2, StaticLayoutThatFits<L3, StaticLayoutThatFits<L4, L5>>> {
+        self.init(in: axes, l1, StaticLayoutThatFits<L2, StaticLayoutThatFits<L3, StaticLayoutThatFits<L4, L5>>>(in: axes, l2, l3, l4, l5))
+    }
+}
+
+// MARK: - Previews
+
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+@available(tvOS, unavailable)
+struct StaticLayoutThatFits_Previews: PreviewProvider {
+    struct Preview: View {
+        @State private var width: CGFloat = 300
+
+        var body: some View {
+            VStack {
+                Slider(value: $width, in: 0...400)
+
+                LayoutAdapter {
+                    StaticLayoutThatFits(in: [.horizontal], _HStackLayout(spacing: nil), _VStackLayout(spacing: nil))
+                } content: {
+                    Text("Static")
+                    Text("Layout")
+                    Text("That")
+                    Text("Fits")
+                }
+                .lineLimit(1)
+                .frame(width: width)
+                .background(Color.gray)
+
+                Spacer()
+            }
+            .padding()
+        }
+    }
+
+    static var previews: some View {
+        Preview()
+    }
+}
@@ -0,0 +1,116 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import Foundation
+import os.lock
+import EngineCore
+
+extension TypeDescriptor {
+
+    /// The protocol conformance of `type`, which is looked up once
+    /// per process and then cached.
+    ///
+    /// A protocol conformance lookup is a runtime call that can be costly when
+    /// it is performed frequently, such as when visiting each element of a
+    /// ``MultiViewAdapter``. Use ``TypeDescriptor/cachedConformance(of:)``
+    /// in place of `conformance(of:)` on hot paths.
+    ///
+    /// > Note: The cache is thread-safe.
+    ///
+    public static func cachedConformance(
+        of type: Any.Type
+    ) -> ProtocolConformance<Self>? {
+        TypeDescriptorCache.shared.conformance(of: type, descriptor: Self.self)
+    }
+
+    /// Looks up and caches the protocol conformance of each of the `types`,
+    /// such as at launch for the types that are known to be visited.
+    public static func prewarm(
+        _ types: Any.Type...
+    ) {
+        for type in types {
+            _ = cachedConformance(of: type)
+        }
+    }
+}
+
+/// The number of subviews of the view `type`, which is computed
+/// with `count` once per process and then cached.
+func cachedViewListCount(
+    of type: Any.Type,
+    _ count: () -> Int?
+) -> Int? {
+    TypeDescriptorCache.shared.viewListCount(of: type, count)
+}
+
+private final class TypeDescriptorCache {
+
+    static let shared = TypeDescriptorCache()
+
+    private final class Conformances<Descriptor: TypeDescriptor> {
+        var values: [ObjectIdentifier: ProtocolConformance<Descriptor>?] = [:]
+    }
+
+    private let lock: UnsafeMutablePointer<os_unfair_lock>
+    private var conformances: [ObjectIdentifier: AnyObject] = [:]
+    private var viewListCounts: [ObjectIdentifier: Int?] = [:]
+
+    private init() {
+        lock = .allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock())
+    }
+
+    func conformance<Descriptor: TypeDescriptor>(
+        of type: Any.Type,
+        descriptor: Descriptor.Type
+    ) -> ProtocolConformance<Descriptor>? {
+        let key = ObjectIdentifier(type)
+        os_unfair_lock_lock(lock)
+        let cache = conformances(descriptor: descriptor)
+        if let conformance = cache.values[key] {
+            os_unfair_lock_unlock(lock)
+            return conformance
+        }
+        os_unfair_lock_unlock(lock)
+
+        // Perform the lookup outside of the lock, since it may be slow
+        let conformance = Descriptor.conformance(of: type)
+        os_unfair_lock_lock(lock)
+        cache.values[key] = .some(conformance)
+        os_unfair_lock_unlock(lock)
+        return conformance
+    }
+
+    func viewListCount(
+        of type: Any.Type,
+        _ count: () -> Int?
+    ) -> Int? {
+        let key = ObjectIdentifier(type)
+        os_unfair_lock_lock(lock)
+        if let viewListCount = viewListCounts[key] {
+            os_unfair_lock_unlock(lock)
+            return viewListCount
+        }
+        os_unfair_lock_unlock(lock)
+
+        // Count outside of the lock, since counting a view counts its children
+        let viewListCount = count()
+        os_unfair_lock_lock(lock)
+        viewListCounts[key] = .some(viewListCount)
+        os_unfair_lock_unlock(lock)
+        return viewListCount
+    }
+
+    private func conformances<Descriptor: TypeDescriptor>(
+        descriptor: Descriptor.Type
+    ) -> Conformances<Descriptor> {
+        let key = ObjectIdentifier(descriptor)
+        if let cache = conformances[key] {
+            return unsafeDowncast(cache, to: Conformances<Descriptor>.self)
+        }
+        let cache = Conformances<Descriptor>()
+        conformances[key] = cache
+        return cache
+    }
+}
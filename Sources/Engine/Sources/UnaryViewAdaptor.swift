@@ -41,20 +41,26 @@ public struct UnaryViewAdaptor<Content: View>: View {
         view: _GraphValue<Self>,
         inputs: _ViewInputs
     ) -> _ViewOutputs {
-        _UnaryViewAdaptor<Content>._makeView(view: view[\.content], inputs: inputs)
+        let signpost = Signpost.begin("_makeView", Self.self)
+        defer { signpost.end() }
+        return _UnaryViewAdaptor<Content>._makeView(view: view[\.content], inputs: inputs)
     }
 
     public static func _makeViewList(
         view: _GraphValue<Self>,
         inputs: _ViewListInputs
     ) -> _ViewListOutputs {
-        _UnaryViewAdaptor<Content>._makeViewList(view: view[\.content], inputs: inputs)
+        let signpost = Signpost.begin("_makeViewList", Self.self)
+        defer { signpost.end() }
+        return _UnaryViewAdaptor<Content>._makeViewList(view: view[\.content], inputs: inputs)
     }
 
     @available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *)
     public static func _viewListCount(
         inputs: _ViewListCountInputs
     ) -> Int? {
-        _UnaryViewAdaptor<Content>._viewListCount(inputs: inputs)
+        let signpost = Signpost.begin("_viewListCount", Self.self)
+        defer { signpost.end() }
+        return _UnaryViewAdaptor<Content>._viewListCount(inputs: inputs)
     }
 }
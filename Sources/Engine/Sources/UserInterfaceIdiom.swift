@@ -0,0 +1,72 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// The user interface idiom of the device, which is resolved once.
+enum UserInterfaceIdiom: String {
+    case phone
+    case pad
+    case mac
+    case tv
+    case watch
+    case unspecified
+
+    static let current: UserInterfaceIdiom = {
+        #if os(macOS)
+        return .mac
+        #elseif os(watchOS)
+        return .watch
+        #else
+        switch UIDevice.current.userInterfaceIdiom {
+        case .phone:
+            return .phone
+        case .pad:
+            return .pad
+        case .mac:
+            return .mac
+        case .tv:
+            return .tv
+        default:
+            return .unspecified
+        }
+        #endif
+    }()
+}
+
+/// A ``StaticCondition`` that is `true` when the user interface idiom is a phone.
+public struct IsPhone: StaticCondition {
+    public static var value: Bool {
+        UserInterfaceIdiom.current == .phone
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when the user interface idiom is a pad.
+public struct IsPad: StaticCondition {
+    public static var value: Bool {
+        UserInterfaceIdiom.current == .pad
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when the user interface idiom is a mac,
+/// which includes Mac Catalyst.
+public struct IsMac: StaticCondition {
+    public static var value: Bool {
+        UserInterfaceIdiom.current == .mac
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when the user interface idiom is a tv.
+public struct IsTv: StaticCondition {
+    public static var value: Bool {
+        UserInterfaceIdiom.current == .tv
+    }
+}
+
+/// A ``StaticCondition`` that is `true` when the user interface idiom is a watch.
+public struct IsWatch: StaticCondition {
+    public static var value: Bool {
+        UserInterfaceIdiom.current == .watch
+    }
+}
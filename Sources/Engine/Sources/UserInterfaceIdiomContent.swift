@@ -9,6 +9,10 @@ import SwiftUI
 /// > Tip: Use ``UserInterfaceIdiomContent`` and ``UserInterfaceIdiomModifer``
 /// to aide with cross platform compatibility.
 ///
+/// > Note: The user interface idiom is resolved once. To branch on a single idiom,
+/// ``IsPhone``, ``IsPad``, ``IsMac``, ``IsTv`` and ``IsWatch`` can be used
+/// with ``StaticConditionalContent`` and ``StaticConditionalModifier``.
+///
 public protocol UserInterfaceIdiomContent: View where Body == Never {
     associatedtype PhoneBody: View = EmptyView
     @ViewBuilder var phoneBody: PhoneBody { get }
@@ -65,10 +69,12 @@ extension UserInterfaceIdiomContent where Body == Never{
         view: _GraphValue<Self>,
         inputs: _ViewInputs
     ) -> _ViewOutputs {
+        let signpost = Signpost.begin("_makeView", Self.self)
+        defer { signpost.end(branch: UserInterfaceIdiom.current.rawValue) }
         #if os(macOS)
         return MacBody._makeView(view: view[\.macBody], inputs: inputs)
         #elseif !os(watchOS)
-        switch UIDevice.current.userInterfaceIdiom {
+        switch UserInterfaceIdiom.current {
         case .phone:
             return PhoneBody._makeView(view: view[\.phoneBody], inputs: inputs)
         case .pad:
@@ -77,9 +83,7 @@ extension UserInterfaceIdiomContent where Body == Never{
             return MacBody._makeView(view: view[\.macBody], inputs: inputs)
         case .tv:
             return TvBody._makeView(view: view[\.tvBody], inputs: inputs)
-        case .unspecified, .carPlay:
-            fallthrough
-        @unknown default:
+        case .watch, .unspecified:
             preconditionFailure("unsupported")
         }
         #elseif os(watchOS)
@@ -91,10 +95,12 @@ extension UserInterfaceIdiomContent where Body == Never{
         view: _GraphValue<Self>,
         inputs: _ViewListInputs
     ) -> _ViewListOutputs {
+        let signpost = Signpost.begin("_makeViewList", Self.self)
+        defer { signpost.end(branch: UserInterfaceIdiom.current.rawValue) }
         #if os(macOS)
         return MacBody._makeViewList(view: view[\.macBody], inputs: inputs)
         #elseif !os(watchOS)
-        switch UIDevice.current.userInterfaceIdiom {
+        switch UserInterfaceIdiom.current {
         case .phone:
             return PhoneBody._makeViewList(view: view[\.phoneBody], inputs: inputs)
         case .pad:
@@ -103,9 +109,7 @@ extension UserInterfaceIdiomContent where Body == Never{
             return MacBody._makeViewList(view: view[\.macBody], inputs: inputs)
         case .tv:
             return TvBody._makeViewList(view: view[\.tvBody], inputs: inputs)
-        case .unspecified, .carPlay:
-            fallthrough
-        @unknown default:
+        case .watch, .unspecified:
             preconditionFailure("unsupported")
         }
         #elseif os(watchOS)
@@ -117,10 +121,12 @@ extension UserInterfaceIdiomContent where Body == Never{
     public static func _viewListCount(
         inputs: _ViewListCountInputs
     ) -> Int? {
+        let signpost = Signpost.begin("_viewListCount", Self.self)
+        defer { signpost.end(branch: UserInterfaceIdiom.current.rawValue) }
         #if os(macOS)
         return MacBody._viewListCount(inputs: inputs)
         #elseif !os(watchOS)
-        switch UIDevice.current.userInterfaceIdiom {
+        switch UserInterfaceIdiom.current {
         case .phone:
             return PhoneBody._viewListCount(inputs: inputs)
         case .pad:
@@ -129,9 +135,7 @@ extension UserInterfaceIdiomContent where Body == Never{
             return MacBody._viewListCount(inputs: inputs)
         case .tv:
             return TvBody._viewListCount(inputs: inputs)
-        case .unspecified, .carPlay:
-            fallthrough
-        @unknown default:
+        case .watch, .unspecified:
             preconditionFailure("unsupported")
         }
         #elseif os(watchOS)
@@ -38,3 +38,77 @@ extension Layout.Subviews.Element {
         _trait(key: VariadicValueKeyBox<K>.self)
     }
 }
+
+/// The values of a ``VariadicValueKey`` for each subview of a `Layout`,
+/// read in a single pass and stored contiguously.
+///
+/// Reading a ``VariadicValueKey`` from a `Layout.Subviews.Element` looks up the
+/// value each time. Store a ``VariadicValues`` in the `Cache` of a `Layout` to
+/// read the values once in `makeCache` and `updateCache`, and then index them by
+/// the position of the subview. Use a ``VariadicValues`` for each key that is needed.
+///
+/// ```
+/// struct WeightedHStack: Layout {
+///     struct Cache {
+///         var weights: VariadicValues<WeightKey>
+///         var priorities: VariadicValues<PriorityKey>
+///     }
+///
+///     func makeCache(subviews: Subviews) -> Cache {
+///         Cache(
+///             weights: VariadicValues(subviews: subviews),
+///             priorities: VariadicValues(subviews: subviews)
+///         )
+///     }
+///
+///     func updateCache(_ cache: inout Cache, subviews: Subviews) {
+///         cache.weights.update(subviews: subviews)
+///         cache.priorities.update(subviews: subviews)
+///     }
+///
+///     func sizeThatFits(proposal: ProposedViewSize, subviews: Subviews, cache: inout Cache) -> CGSize {
+///         let totalWeight = cache.weights.reduce(0, +)
+///         // ...
+///     }
+/// }
+/// ```
+@frozen
+@available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *)
+public struct VariadicValues<Key: VariadicValueKey>: RandomAccessCollection {
+
+    public private(set) var values: [Key.Value]
+
+    public init(
+        _ : Key.Type = Key.self,
+        subviews: LayoutSubviews
+    ) {
+        self.values = []
+        update(subviews: subviews)
+    }
+
+    /// Reads the values again, such as when the subviews change
+    public mutating func update(subviews: LayoutSubviews) {
+        values.removeAll(keepingCapacity: true)
+        values.reserveCapacity(subviews.count)
+        for subview in subviews {
+            values.append(subview[key: Key.self])
+        }
+    }
+
+    // MARK: Collection
+
+    public typealias Element = Key.Value
+    public typealias Index = Int
+
+    public var startIndex: Index {
+        values.startIndex
+    }
+
+    public var endIndex: Index {
+        values.endIndex
+    }
+
+    public subscript(position: Index) -> Element {
+        values[position]
+    }
+}
@@ -49,11 +49,30 @@ public struct AnyVariadicView: View, RandomAccessCollection {
     // MARK: Collection
 
     public typealias Element = Subview
-    public typealias Iterator = IndexingIterator<Array<Element>>
     public typealias Index = Int
+    public typealias SubSequence = Slice
+
+    /// An iterator that wraps each subview on demand
+    @frozen
+    public struct Iterator: IteratorProtocol {
+
+        @usableFromInline
+        var iterator: _VariadicView.Children.Iterator
+
+        init(_ iterator: _VariadicView.Children.Iterator) {
+            self.iterator = iterator
+        }
+
+        public mutating func next() -> Element? {
+            guard let element = iterator.next() else {
+                return nil
+            }
+            return Subview(element)
+        }
+    }
 
     public func makeIterator() -> Iterator {
-        children.map { Subview($0) }.makeIterator()
+        Iterator(children.makeIterator())
     }
 
     public var startIndex: Index {
@@ -71,6 +90,114 @@ public struct AnyVariadicView: View, RandomAccessCollection {
     public func index(after index: Index) -> Index {
         children.index(after: index)
     }
+
+    public subscript(bounds: Range<Index>) -> Slice {
+        Slice(children: self, range: bounds)
+    }
+
+    /// A contiguous range of the subviews, that can be rendered without
+    /// copying the subviews.
+    ///
+    /// Taking the `prefix`, `suffix` or dropping subviews produces a ``Slice``,
+    /// which keeps the `id` of each subview.
+    @frozen
+    public struct Slice: View, RandomAccessCollection {
+
+        @usableFromInline
+        var children: AnyVariadicView
+
+        @usableFromInline
+        var range: Range<Int>
+
+        init(children: AnyVariadicView, range: Range<Int>) {
+            self.children = children
+            self.range = range
+        }
+
+        // MARK: View
+
+        public var body: some View {
+            ForEach(self) { subview in
+                subview
+            }
+        }
+
+        // MARK: Collection
+
+        public typealias Element = Subview
+        public typealias Index = Int
+        public typealias SubSequence = Slice
+
+        public var startIndex: Index {
+            range.lowerBound
+        }
+
+        public var endIndex: Index {
+            range.upperBound
+        }
+
+        public subscript(position: Index) -> Element {
+            children[position]
+        }
+
+        public subscript(bounds: Range<Index>) -> Slice {
+            Slice(children: children, range: bounds)
+        }
+    }
+
+    /// Splits the subviews into ``Slice``'s of `count` subviews, of
+    /// which the last may be shorter.
+    ///
+    /// ```
+    /// VariadicViewAdapter { content in
+    ///     HStack(alignment: .top) {
+    ///         ForEach(content.children.chunks(ofCount: 3), id: \.startIndex) { column in
+    ///             VStack {
+    ///                 column
+    ///             }
+    ///         }
+    ///     }
+    /// } source: {
+    ///     content
+    /// }
+    /// ```
+    public func chunks(ofCount count: Int) -> Chunks {
+        Chunks(children: self, count: count)
+    }
+
+    /// A collection of consecutive ``Slice``'s of the subviews
+    @frozen
+    public struct Chunks: RandomAccessCollection {
+
+        @usableFromInline
+        var children: AnyVariadicView
+
+        @usableFromInline
+        var size: Int
+
+        init(children: AnyVariadicView, count: Int) {
+            precondition(count > 0, "Chunks must have a count greater than zero")
+            self.children = children
+            self.size = count
+        }
+
+        public typealias Element = Slice
+        public typealias Index = Int
+
+        public var startIndex: Index {
+            0
+        }
+
+        public var endIndex: Index {
+            (children.count + size - 1) / size
+        }
+
+        public subscript(position: Index) -> Element {
+            let lowerBound = children.startIndex + position * size
+            let upperBound = min(lowerBound + size, children.endIndex)
+            return children[lowerBound..<upperBound]
+        }
+    }
 }
 
 /// A view that transforms a each variadic view subview
@@ -95,10 +222,37 @@ public struct ForEachSubview<
     }
 
     public var body: some View {
-        ForEach(Array(content.children.enumerated()), id: \.element.id) { (index, element) in
-            subview(index, element)
+        ForEach(EnumeratedSubviews(children: content.children)) { element in
+            subview(element.offset, element.subview)
+        }
+    }
+}
+
+/// A collection of subviews with their offset that is read on demand
+private struct EnumeratedSubviews: RandomAccessCollection {
+
+    struct Element: Identifiable {
+        var offset: Int
+        var subview: AnyVariadicView.Subview
+
+        var id: AnyHashable {
+            subview.id
         }
     }
+
+    var children: AnyVariadicView
+
+    var startIndex: Int {
+        children.startIndex
+    }
+
+    var endIndex: Int {
+        children.endIndex
+    }
+
+    subscript(position: Int) -> Element {
+        Element(offset: position - startIndex, subview: children[position])
+    }
 }
 
 /// A container view with type-erased subviews
@@ -180,6 +334,20 @@ struct VariadicView_Previews: PreviewProvider {
                 Text("Line 1")
                 Text("Line 2")
             }
+
+            VariadicViewAdapter { content in
+                HStack(alignment: .top) {
+                    ForEach(content.children.chunks(ofCount: 2), id: \.startIndex) { column in
+                        VStack {
+                            column
+                        }
+                    }
+                }
+            } source: {
+                Text("Line 1")
+                Text("Line 2")
+                Text("Line 3")
+            }
         }
         .padding()
         .previewLayout(.sizeThatFits)
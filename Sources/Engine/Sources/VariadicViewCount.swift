@@ -0,0 +1,336 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+extension VariadicView {
+
+    /// The number of subviews `Content` produces, if it is statically known.
+    ///
+    /// The count is determined from the type of `Content`, without building
+    /// the view or its subviews. This can be used to choose between a single
+    /// and multiple subview code path, or skip work for empty content.
+    ///
+    /// ```
+    /// VariadicView.staticCount(of: TupleView<(Text, Text)>.self) // 2
+    /// VariadicView.staticCount(of: EmptyView.self) // 0
+    /// VariadicView.staticCount(of: ForEach<Range<Int>, Int, Text>.self) // nil
+    /// ```
+    ///
+    /// > Note: The count is `nil` for content that is dynamic, such as a `ForEach`,
+    /// an `if` without an `else`, `AnyView`, or content modified by a custom `ViewModifier`.
+    /// It is also `nil` for a primitive view that is not known to produce a single subview,
+    /// since a primitive such as `Section` can produce many.
+    ///
+    public static func staticCount(
+        of _: Content.Type = Content.self
+    ) -> Int? {
+        viewListCount(of: Content.self)
+    }
+}
+
+/// A view that's number of subviews can be determined from its type
+protocol StaticViewListCount {
+    static var staticViewListCount: Int? { get }
+}
+
+/// The number of subviews of `Content`, which is computed once per type and then cached
+func viewListCount<Content: View>(
+    of _: Content.Type
+) -> Int? {
+    cachedViewListCount(of: Content.self) {
+        uncachedViewListCount(of: Content.self)
+    }
+}
+
+private func uncachedViewListCount<Content: View>(
+    of _: Content.Type
+) -> Int? {
+    if let content = Content.self as? StaticViewListCount.Type {
+        return content.staticViewListCount
+    } else if let content = Content.self as? any VersionedView.Type {
+        return versionedViewListCount(of: content)
+    } else if let content = Content.self as? any UserInterfaceIdiomContent.Type {
+        return userInterfaceIdiomViewListCount(of: content)
+    } else if Content.self is any Shape.Type {
+        return 1
+    } else if Content.Body.self == Never.self {
+        // Primitive views that are not known to be unary may produce
+        // any number of subviews, such as a `Section`
+        return nil
+    }
+    return viewListCount(of: Content.Body.self)
+}
+
+/// The number of subviews of a view with the type of `type`, if it is a `View`
+private func viewListCount(
+    ofAny type: Any.Type
+) -> Int? {
+    guard let conformance = ViewProtocolDescriptor.cachedConformance(of: type) else {
+        return nil
+    }
+    var visitor = StaticViewListCountVisitor()
+    conformance.visit(visitor: &visitor)
+    return visitor.output
+}
+
+private struct StaticViewListCountVisitor: ViewVisitor {
+    var output: Int?
+
+    mutating func visit<Content>(type: Content.Type) where Content: View {
+        output = viewListCount(of: Content.self)
+    }
+}
+
+private func versionedViewListCount<Content: VersionedView>(
+    of _: Content.Type
+) -> Int? {
+    if #available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *) {
+        return viewListCount(of: Content.V4Body.self)
+    }
+    #if !ENGINE_MINIMUM_V4
+    if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+        return viewListCount(of: Content.V3Body.self)
+    }
+    #endif
+    #if !ENGINE_MINIMUM_V3
+    if #available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *) {
+        return viewListCount(of: Content.V2Body.self)
+    }
+    #endif
+    #if !ENGINE_MINIMUM_V2
+    return viewListCount(of: Content.V1Body.self)
+    #else
+    return nil
+    #endif
+}
+
+private func userInterfaceIdiomViewListCount<Content: UserInterfaceIdiomContent>(
+    of _: Content.Type
+) -> Int? {
+    #if os(macOS)
+    return viewListCount(of: Content.MacBody.self)
+    #elseif !os(watchOS)
+    switch UserInterfaceIdiom.current {
+    case .phone:
+        return viewListCount(of: Content.PhoneBody.self)
+    case .pad:
+        return viewListCount(of: Content.PadBody.self)
+    case .mac:
+        return viewListCount(of: Content.MacBody.self)
+    case .tv:
+        return viewListCount(of: Content.TvBody.self)
+    case .watch, .unspecified:
+        return nil
+    }
+    #elseif os(watchOS)
+    return viewListCount(of: Content.WatchBody.self)
+    #endif
+}
+
+// MARK: - TupleTypeMetadata
+
+/// The element types of a tuple type, or `nil` if `type` is not a tuple
+/// or its metadata does not have the expected layout
+private func tupleElementTypes(
+    _ type: Any.Type
+) -> [Any.Type]? {
+    guard let metadata = TupleTypeMetadata(type) else {
+        return nil
+    }
+    return metadata.elementTypes
+}
+
+/// The number of elements of a tuple type, or `nil` if `type` is not a tuple
+/// or its metadata does not have the expected layout
+func tupleCount(
+    of type: Any.Type
+) -> Int? {
+    TupleTypeMetadata(type)?.count
+}
+
+/// A reader of the runtime metadata of a tuple type.
+///
+/// The layout matches `TargetTupleTypeMetadata` from the stable Swift ABI,
+/// see `swift/include/swift/ABI/Metadata.h`:
+///
+/// ```
+/// struct TargetTupleTypeMetadata {
+///     StoredPointer Kind;       // MetadataKind::Tuple
+///     StoredSize NumElements;
+///     const char *Labels;
+///     Element Elements[];       // { const Metadata *Type; StoredSize Offset; }
+/// }
+/// ```
+///
+/// `MetadataKind::Tuple` is `1 | MetadataKindIsNonHeap | MetadataKindIsRuntimePrivate`,
+/// which is `1 | 0x200 | 0x100`, or `0x301`, see `swift/include/swift/ABI/MetadataKind.def`.
+///
+/// > Note: `swift_getTupleCount` and `swift_getTupleElement` from `EngineCore`
+/// read a tuple value, where as this reads the tuple type, without a value.
+///
+private struct TupleTypeMetadata {
+
+    private static let kind = 0x301
+
+    private struct Element {
+        var type: Any.Type
+        var offset: Int
+    }
+
+    private var pointer: UnsafePointer<Int>
+
+    init?(_ type: Any.Type) {
+        // The metadata is addressed by the type, since a metatype of a
+        // non-class type is a single pointer to its metadata
+        guard MemoryLayout<Any.Type>.size == MemoryLayout<UnsafeRawPointer>.size else {
+            return nil
+        }
+        let pointer = unsafeBitCast(type, to: UnsafePointer<Int>.self)
+        guard pointer.pointee == Self.kind, pointer[1] >= 0 else {
+            return nil
+        }
+        self.pointer = pointer
+    }
+
+    var count: Int {
+        pointer[1]
+    }
+
+    var elementTypes: [Any.Type] {
+        let count = count
+        return UnsafeRawPointer(pointer.advanced(by: 3))
+            .withMemoryRebound(to: Element.self, capacity: count) { elements in
+                (0..<count).map { elements[$0].type }
+            }
+    }
+}
+
+// MARK: - StaticViewListCount
+
+extension EmptyView: StaticViewListCount {
+    static var staticViewListCount: Int? { 0 }
+}
+
+extension AnyView: StaticViewListCount {
+    static var staticViewListCount: Int? { nil }
+}
+
+extension ForEach: StaticViewListCount {
+    static var staticViewListCount: Int? { nil }
+}
+
+extension Optional: StaticViewListCount where Wrapped: View {
+    static var staticViewListCount: Int? {
+        viewListCount(of: Wrapped.self) == 0 ? 0 : nil
+    }
+}
+
+extension Group: StaticViewListCount where Content: View {
+    static var staticViewListCount: Int? {
+        viewListCount(of: Content.self)
+    }
+}
+
+extension TupleView: StaticViewListCount {
+    static var staticViewListCount: Int? {
+        guard let types = tupleElementTypes(T.self) else {
+            return viewListCount(ofAny: T.self)
+        }
+        var count = 0
+        for type in types {
+            guard let elementCount = viewListCount(ofAny: type) else {
+                return nil
+            }
+            count += elementCount
+        }
+        return count
+    }
+}
+
+extension _ConditionalContent: StaticViewListCount where TrueContent: View, FalseContent: View {
+    static var staticViewListCount: Int? {
+        let trueCount = viewListCount(of: TrueContent.self)
+        return trueCount == viewListCount(of: FalseContent.self) ? trueCount : nil
+    }
+}
+
+extension ModifiedContent: StaticViewListCount where Content: View, Modifier: ViewModifier {
+    static var staticViewListCount: Int? {
+        // Primitive modifiers are applied to each subview, where as a custom
+        // modifier may place its content in a container
+        guard Modifier.Body.self == Never.self else {
+            return nil
+        }
+        return viewListCount(of: Content.self)
+    }
+}
+
+extension ViewAdapter: StaticViewListCount {
+    static var staticViewListCount: Int? {
+        viewListCount(of: Content.self)
+    }
+}
+
+extension MultiViewAdapter: StaticViewListCount {
+    static var staticViewListCount: Int? {
+        TupleView<Content>.staticViewListCount
+    }
+}
+
+extension Text: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension Image: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension Color: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension Spacer: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension Divider: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension HStack: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension VStack: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension ZStack: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension ScrollView: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension _ShapeView: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension UnaryViewAdaptor: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension _UnaryViewAdaptor: StaticViewListCount {
+    static var staticViewListCount: Int? { 1 }
+}
+
+extension StaticConditionalContent: StaticViewListCount {
+    static var staticViewListCount: Int? {
+        Condition.value
+            ? viewListCount(of: TrueContent.self)
+            : viewListCount(of: FalseContent.self)
+    }
+}
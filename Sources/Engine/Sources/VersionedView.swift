@@ -17,6 +17,11 @@ import SwiftUI
 /// > Tip: Use ``VersionedView`` and ``VersionedViewModifier``
 /// to aide with backwards compatibility.
 ///
+/// If the deployment target of the app makes older versions unreachable, set
+/// the `ENGINE_MINIMUM_VERSION` environment variable to `v2`, `v3` or `v4` when
+/// resolving the package so that the bodies for older versions are not compiled
+/// into `Engine`.
+///
 public protocol VersionedView: View where Body == Never {
     associatedtype V4Body: View = V3Body
 
@@ -57,7 +62,7 @@ extension VersionedView where V1Body == EmptyView {
     public var v1Body: V1Body { EmptyView() }
 }
 
-extension VersionedView where Body == Never{
+extension VersionedView where Body == Never {
     public var body: Never {
         bodyError()
     }
@@ -66,43 +71,81 @@ extension VersionedView where Body == Never{
         view: _GraphValue<Self>,
         inputs: _ViewInputs
     ) -> _ViewOutputs {
+        let signpost = Signpost.begin("_makeView", Self.self)
         if #available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *) {
+            defer { signpost.end(branch: "v4Body") }
             return V4Body._makeView(view: view[\.v4Body], inputs: inputs)
-        } else if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+        }
+        #if !ENGINE_MINIMUM_V4
+        if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+            defer { signpost.end(branch: "v3Body") }
             return V3Body._makeView(view: view[\.v3Body], inputs: inputs)
-        } else if #available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *) {
+        }
+        #endif
+        #if !ENGINE_MINIMUM_V3
+        if #available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *) {
+            defer { signpost.end(branch: "v2Body") }
             return V2Body._makeView(view: view[\.v2Body], inputs: inputs)
-        } else {
-            return V1Body._makeView(view: view[\.v1Body], inputs: inputs)
         }
+        #endif
+        #if !ENGINE_MINIMUM_V2
+        defer { signpost.end(branch: "v1Body") }
+        return V1Body._makeView(view: view[\.v1Body], inputs: inputs)
+        #else
+        preconditionFailure("Unsupported version")
+        #endif
     }
 
     public static func _makeViewList(
         view: _GraphValue<Self>,
         inputs: _ViewListInputs
     ) -> _ViewListOutputs {
+        let signpost = Signpost.begin("_makeViewList", Self.self)
         if #available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *) {
+            defer { signpost.end(branch: "v4Body") }
             return V4Body._makeViewList(view: view[\.v4Body], inputs: inputs)
-        } else if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+        }
+        #if !ENGINE_MINIMUM_V4
+        if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+            defer { signpost.end(branch: "v3Body") }
             return V3Body._makeViewList(view: view[\.v3Body], inputs: inputs)
-        } else if #available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *) {
+        }
+        #endif
+        #if !ENGINE_MINIMUM_V3
+        if #available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *) {
+            defer { signpost.end(branch: "v2Body") }
             return V2Body._makeViewList(view: view[\.v2Body], inputs: inputs)
-        } else {
-            return V1Body._makeViewList(view: view[\.v1Body], inputs: inputs)
         }
+        #endif
+        #if !ENGINE_MINIMUM_V2
+        defer { signpost.end(branch: "v1Body") }
+        return V1Body._makeViewList(view: view[\.v1Body], inputs: inputs)
+        #else
+        preconditionFailure("Unsupported version")
+        #endif
     }
 
     @available(iOS 14.0, macOS 11.0, tvOS 14.0, watchOS 7.0, *)
     public static func _viewListCount(
         inputs: _ViewListCountInputs
     ) -> Int? {
+        let signpost = Signpost.begin("_viewListCount", Self.self)
         if #available(iOS 16.0, macOS 13.0, tvOS 16.0, watchOS 9.0, *) {
+            defer { signpost.end(branch: "v4Body") }
             return V4Body._viewListCount(inputs: inputs)
-        } else if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+        }
+        #if !ENGINE_MINIMUM_V4
+        if #available(iOS 15.0, macOS 12.0, tvOS 15.0, watchOS 8.0, *) {
+            defer { signpost.end(branch: "v3Body") }
             return V3Body._viewListCount(inputs: inputs)
-        } else {
-            return V2Body._viewListCount(inputs: inputs)
         }
+        #endif
+        #if !ENGINE_MINIMUM_V3
+        defer { signpost.end(branch: "v2Body") }
+        return V2Body._viewListCount(inputs: inputs)
+        #else
+        preconditionFailure("Unsupported version")
+        #endif
     }
 }
 
@@ -17,6 +17,9 @@ import SwiftUI
 /// > Tip: Use ``VersionedView`` and ``VersionedViewModifier``
 /// to aide with backwards compatibility.
 ///
+/// > Note: The body is resolved by a ``VersionedView``, so the same
+/// `ENGINE_MINIMUM_VERSION` pruning applies.
+///
 public protocol VersionedViewModifier: ViewModifier {
     associatedtype V4Body: View = V3Body
 
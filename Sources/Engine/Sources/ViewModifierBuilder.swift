@@ -5,6 +5,19 @@
 import SwiftUI
 
 /// A custom parameter attribute that constructs a `ViewModifier` from closures.
+///
+/// ```
+/// var isHighlighted: Bool
+///
+/// @ViewModifierBuilder
+/// var modifier: some ViewModifier {
+///     if isHighlighted {
+///         HighlightModifier()
+///     } else {
+///         DimmedModifier()
+///     }
+/// }
+/// ```
 @resultBuilder
 public struct ViewModifierBuilder {
     public static func buildBlock() -> EmptyModifier {
@@ -68,6 +81,55 @@ public struct ViewModifierBuilder {
     ) -> ModifiedContent<ModifiedContent<ModifiedContent<ModifiedContent<M0, M1>, M2>, M3>, M4> {
         m0.concat(m1).concat(m2).concat(m3).concat(m4)
     }
+
+    public static func buildPartialBlock<Modifier: ViewModifier>(
+        first: Modifier
+    ) -> Modifier {
+        first
+    }
+
+    public static func buildPartialBlock<
+        Accumulated: ViewModifier,
+        Next: ViewModifier
+    >(
+        accumulated: Accumulated,
+        next: Next
+    ) -> ModifiedContent<Accumulated, Next> {
+        accumulated.concat(next)
+    }
+
+    public static func buildEither<
+        TrueModifier: ViewModifier,
+        FalseModifier: ViewModifier
+    >(
+        first: TrueModifier
+    ) -> ConditionalModifier<TrueModifier, FalseModifier> {
+        ConditionalModifier(first)
+    }
+
+    public static func buildEither<
+        TrueModifier: ViewModifier,
+        FalseModifier: ViewModifier
+    >(
+        second: FalseModifier
+    ) -> ConditionalModifier<TrueModifier, FalseModifier> {
+        ConditionalModifier(second)
+    }
+
+    public static func buildOptional<Modifier: ViewModifier>(
+        _ modifier: Modifier?
+    ) -> ConditionalModifier<Modifier, EmptyModifier> {
+        if let modifier = modifier {
+            return ConditionalModifier(modifier)
+        }
+        return ConditionalModifier(EmptyModifier())
+    }
+
+    public static func buildLimitedAvailability<Modifier: ViewModifier>(
+        _ modifier: Modifier
+    ) -> _AnyViewModifier {
+        _AnyViewModifier(modifier)
+    }
 }
 
 extension View {
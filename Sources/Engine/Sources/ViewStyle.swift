@@ -113,6 +113,13 @@ import EngineCore
 /// > Note: Unlike the default style which is only applied if another style is defined,
 /// the styling defined by the `body` of ``ViewStyledView`` is always applied once.
 ///
+/// # Resolution Depth
+///
+/// Each ``View/styledViewStyle(_:style:)`` between a ``ViewStyledView`` and the
+/// root of the view hierarchy is resolved through. Prefer applying a style once,
+/// as close to the views that use it as possible, and use ``ViewStyleDepthReader``
+/// to find where styles are stacked.
+///
 public typealias ViewStyle = EngineCore.ViewStyle
 
 /// A protocol that defines a view that is styled with the related ``ViewStyle``.
@@ -134,7 +141,12 @@ extension View {
         _ : StyledView.Type,
         style: Style
     ) -> some View where StyledView.Configuration == Style.Configuration {
+        #if ENGINE_INSTRUMENTATION
         modifier(ViewStyleModifier(StyledView.self, style: style))
+            .modifier(ViewStyleDepthModifier(StyledView.self, isReset: false))
+        #else
+        modifier(ViewStyleModifier(StyledView.self, style: style))
+        #endif
     }
 
     /// Resets the `StyledView` to its default style.
@@ -148,6 +160,11 @@ extension View {
     >(
         _ : StyledView.Type
     ) -> some View {
+        #if ENGINE_INSTRUMENTATION
+        modifier(DefaultViewStyleModifier<StyledView>())
+            .modifier(ViewStyleDepthModifier(StyledView.self, isReset: true))
+        #else
         modifier(DefaultViewStyleModifier<StyledView>())
+        #endif
     }
 }
@@ -0,0 +1,82 @@
+//
+// Copyright (c) Nathan Tannar
+//
+
+import SwiftUI
+
+/// A view that reads the number of ``ViewStyle``'s that have been applied
+/// to `StyledView` by its ancestors.
+///
+/// Each ``View/styledViewStyle(_:style:)`` adds to the depth a ``ViewStyledView``
+/// may resolve through, and ``View/defaultViewStyle(_:)`` resets it. Use a
+/// ``ViewStyleDepthReader`` to find screens with deeply stacked styles.
+///
+/// ```
+/// ViewStyleDepthReader(LabeledViewBody.self) { depth in
+///     LabeledView {
+///         Text("Content")
+///     } label: {
+///         Text("Depth \(depth)")
+///     }
+/// }
+/// ```
+///
+/// > Note: The depth is only counted when `Engine` is compiled with the
+/// `ENGINE_INSTRUMENTATION` condition, otherwise it is always zero. This keeps
+/// the view graph of a style the same in Debug and Release builds.
+///
+public struct ViewStyleDepthReader<
+    StyledView: ViewStyledView,
+    Content: View
+>: View {
+
+    var content: (Int) -> Content
+
+    public init(
+        _ : StyledView.Type,
+        @ViewBuilder content: @escaping (Int) -> Content
+    ) {
+        self.content = content
+    }
+
+    @Environment(\.viewStyleDepths) private var depths
+
+    public var body: some View {
+        content(depths[ObjectIdentifier(StyledView.self)] ?? 0)
+    }
+}
+
+/// A modifier that counts the styles applied to `StyledView`, which is only
+/// applied when `Engine` is compiled with the `ENGINE_INSTRUMENTATION` condition
+@frozen
+@usableFromInline
+struct ViewStyleDepthModifier<StyledView: ViewStyledView>: ViewModifier {
+
+    @usableFromInline
+    var isReset: Bool
+
+    @inlinable
+    init(_ : StyledView.Type, isReset: Bool) {
+        self.isReset = isReset
+    }
+
+    @usableFromInline
+    func body(content: Content) -> some View {
+        content
+            .transformEnvironment(\.viewStyleDepths) { depths in
+                let key = ObjectIdentifier(StyledView.self)
+                depths[key] = isReset ? 0 : (depths[key] ?? 0) + 1
+            }
+    }
+}
+
+private struct ViewStyleDepthsKey: EnvironmentKey {
+    static let defaultValue: [ObjectIdentifier: Int] = [:]
+}
+
+extension EnvironmentValues {
+    fileprivate var viewStyleDepths: [ObjectIdentifier: Int] {
+        get { self[ViewStyleDepthsKey.self] }
+        set { self[ViewStyleDepthsKey.self] = newValue }
+    }
+}
@@ -43,7 +43,7 @@ public typealias ViewModifierVisitor = EngineCore.ViewModifierVisitor
 ///
 ///     func makeUIHostingController(content: Any) -> UIViewController? {
 ///         func project<Content>(_ content: Content) -> UIViewController? {
-///             guard let conformance = ViewProtocolDescriptor.conformance(of: Content.self)
+///             guard let conformance = ViewProtocolDescriptor.cachedConformance(of: Content.self)
 ///             else {
 ///                 return nil
 ///             }
@@ -62,7 +62,11 @@ public typealias ViewModifierVisitor = EngineCore.ViewModifierVisitor
 ///             output = UIHostingController(rootView: unsafeBitCast(input, to: Content.self))
 ///         }
 ///     }
-///     
+///
+/// > Tip: Prefer ``TypeDescriptor/cachedConformance(of:)`` on hot paths, as the
+/// result of the runtime lookup is cached for each type. Known types can be looked up
+/// ahead of time with ``TypeDescriptor/prewarm(_:)``.
+///
 public typealias TypeDescriptor = EngineCore.TypeDescriptor
 
 /// The ``TypeDescriptor`` for the `View` protocol